@@ -0,0 +1,120 @@
+// Benchmarks the JS API and runs the native baseline built next to the addon. Prints JSON to stdout.
+//
+// Usage: node bench.js [seconds per benchmark]
+
+const fs = require('fs')
+const path = require('path')
+const { execFileSync } = require('child_process')
+const bindings = require('bindings')
+const poker = require('./poker')
+
+const seconds = Number(process.argv[2] || 1)
+const forcedBets = { ante: 0, smallBlind: 10, bigBlind: 20 }
+
+// Calls run(batch) with growing batches until at least `seconds` have passed. setup(batch) is not timed.
+function measure(name, run, setup = () => {}) {
+    let iterations = 0
+    let elapsed = 0n
+    for (let batch = 1; elapsed < BigInt(Math.round(seconds * 1e9)); batch *= 2) {
+        setup(batch)
+        const start = process.hrtime.bigint()
+        run(batch)
+        elapsed += process.hrtime.bigint() - start
+        iterations += batch
+    }
+    const s = Number(elapsed) / 1e9
+    return { name, iterations, seconds: s, opsPerSec: iterations / s, nsPerOp: s * 1e9 / iterations }
+}
+
+function seatPlayers(table, numPlayers) {
+    for (let i = 0; i < numPlayers; ++i) {
+        table.sitDown(i, 1000000)
+    }
+    return table
+}
+
+function playHand(table) {
+    table.startHand()
+    while (table.isHandInProgress()) {
+        while (table.isBettingRoundInProgress()) {
+            table.actionTaken(table.legalActions().actions.includes('check') ? 'check' : 'call')
+        }
+        table.endBettingRound()
+        if (table.areBettingRoundsCompleted()) {
+            table.showdown()
+        }
+    }
+}
+
+// Full ring table on the flop, where every player can check.
+function flopTable() {
+    const table = seatPlayers(new poker.Table(forcedBets), 9)
+    table.startHand()
+    while (table.isBettingRoundInProgress()) {
+        table.actionTaken(table.legalActions().actions.includes('check') ? 'check' : 'call')
+    }
+    table.endBettingRound()
+    return table
+}
+
+function benchmarkJs() {
+    const results = []
+
+    for (const [name, numPlayers] of [['js.hands.headsUp', 2], ['js.hands.fullRing', 9]]) {
+        const table = seatPlayers(new poker.Table(forcedBets), numPlayers)
+        results.push(measure(name, batch => {
+            for (let i = 0; i < batch; ++i) {
+                playHand(table)
+            }
+        }))
+    }
+
+    const table = flopTable()
+    const snapshot = new Int32Array(poker.SNAPSHOT_SIZE)
+    const observers = [
+        'seats', 'forcedBets', 'isHandInProgress', 'isBettingRoundInProgress', 'areBettingRoundsCompleted',
+        'handPlayers', 'button', 'playerToAct', 'numActivePlayers', 'pots', 'roundOfBetting', 'communityCards',
+        'legalActions', 'automaticActions', 'holeCards'
+    ]
+    for (const method of observers) {
+        results.push(measure(`js.${method}`, batch => {
+            for (let i = 0; i < batch; ++i) {
+                table[method]()
+            }
+        }))
+    }
+    results.push(measure('js.snapshot', batch => {
+        for (let i = 0; i < batch; ++i) {
+            table.snapshot(snapshot)
+        }
+    }))
+
+    // Each prepared flop table takes 9 checks before its betting round ends.
+    let tables = []
+    results.push(measure('js.actionTaken', batch => {
+        for (let i = 0; i < batch; ++i) {
+            tables[Math.floor(i / 9)].actionTaken('check')
+        }
+    }, batch => {
+        tables = Array.from({ length: Math.ceil(batch / 9) }, flopTable)
+    }))
+
+    return results
+}
+
+function benchmarkNative() {
+    const executable = path.join(path.dirname(bindings({ bindings: 'addon', path: true })),
+                                 process.platform === 'win32' ? 'benchmark.exe' : 'benchmark')
+    if (!fs.existsSync(executable)) {
+        return []
+    }
+    return JSON.parse(execFileSync(executable, [String(seconds)], { encoding: 'utf8' })).results
+}
+
+console.log(JSON.stringify({
+    timestamp: new Date().toISOString(),
+    node: process.versions.node,
+    napi: process.versions.napi,
+    platform: `${process.platform}-${process.arch}`,
+    results: [...benchmarkJs(), ...benchmarkNative()]
+}, null, 2))
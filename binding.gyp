@@ -1,16 +1,123 @@
 {
+  "variables": {
+    # Set POKER_METRICS=1 when building to compile in the instrumentation read by poker.metrics().
+    "poker_metrics%": "<!(node -p \"process.env.POKER_METRICS || 0\")"
+  },
   "targets": [
     {
       "target_name": "addon",
       "cflags": [ "-std=c++17", "-fexceptions" ],
       "cflags_cc": [ "-std=c++17", "-fexceptions" ],
-      "sources": [ "src/addon.cc", "src/Table.cc" ],
+      "sources": [
+        "src/addon.cc",
+        "src/BoardTexture.cc",
+        "src/CardSets.cc",
+        "src/Conversions.cc",
+        "src/Equity.cc",
+        "src/EquityWorker.cc",
+        "src/EventLog.cc",
+        "src/Explore.cc",
+        "src/HandEvaluator.cc",
+        "src/HandHistory.cc",
+        "src/Metrics.cc",
+        "src/PreflopEquity.cc",
+        "src/PreflopEquityLookup.cc",
+        "src/Range.cc",
+        "src/RangeEquity.cc",
+        "src/RangeEquityWorker.cc",
+        "src/Rng.cc",
+        "src/SimulateWorker.cc",
+        "src/Simulator.cc",
+        "src/Snapshot.cc",
+        "src/Table.cc",
+        "src/TableSet.cc",
+        "src/ThreadPool.cc",
+        "src/Tournament.cc",
+        "src/TournamentEngine.cc"
+      ],
       "include_dirs": [
         "<!@(node -p \"require('node-addon-api').include\")",
         "./src/poker/include",
         "./src/poker/third_party/span-lite/include"
       ],
-      'defines': [ 'NAPI_CPP_EXCEPTIONS' ],
+      # Instance data, BigInt and BigUint64Array need Node-API 6.
+      'defines': [ 'NAPI_CPP_EXCEPTIONS', 'NAPI_VERSION=6' ],
+      'conditions': [
+        [ 'poker_metrics==1', { 'defines': [ 'POKER_METRICS' ] } ],
+      ],
+      'copies': [
+        {
+          'destination': '<(PRODUCT_DIR)',
+          'files': [ 'data/preflop_equity.bin' ],
+        },
+      ],
+      'msvs_settings': {
+        'VCCLCompilerTool': {
+          'AdditionalOptions': [ '/std:c++17', '/EHsc'],
+        },
+      },
+    },
+    {
+      "target_name": "generate_preflop_equity",
+      "type": "executable",
+      "cflags": [ "-std=c++17", "-fexceptions" ],
+      "cflags_cc": [ "-std=c++17", "-fexceptions" ],
+      "sources": [
+        "tools/GeneratePreflopEquity.cc",
+        "src/HandEvaluator.cc",
+        "src/PreflopEquity.cc"
+      ],
+      "include_dirs": [
+        "./src",
+        "./src/poker/include",
+        "./src/poker/third_party/span-lite/include"
+      ],
+      'msvs_settings': {
+        'VCCLCompilerTool': {
+          'AdditionalOptions': [ '/std:c++17', '/EHsc'],
+        },
+      },
+    },
+    {
+      "target_name": "benchmark",
+      "type": "executable",
+      "cflags": [ "-std=c++17", "-fexceptions" ],
+      "cflags_cc": [ "-std=c++17", "-fexceptions" ],
+      "sources": [
+        "tools/Benchmark.cc",
+        "src/Snapshot.cc"
+      ],
+      "include_dirs": [
+        "./src",
+        "./src/poker/include",
+        "./src/poker/third_party/span-lite/include"
+      ],
+      'msvs_settings': {
+        'VCCLCompilerTool': {
+          'AdditionalOptions': [ '/std:c++17', '/EHsc'],
+        },
+      },
+    },
+    {
+      "target_name": "simulate",
+      "type": "executable",
+      "cflags": [ "-std=c++17", "-fexceptions", "-pthread" ],
+      "cflags_cc": [ "-std=c++17", "-fexceptions", "-pthread" ],
+      "ldflags": [ "-pthread" ],
+      "sources": [
+        "tools/Simulate.cc",
+        "src/Equity.cc",
+        "src/HandEvaluator.cc",
+        "src/PreflopEquity.cc",
+        "src/Range.cc",
+        "src/Rng.cc",
+        "src/Simulator.cc"
+      ],
+      "include_dirs": [
+        "./src",
+        "./src/poker/include",
+        "./src/poker/third_party/span-lite/include"
+      ],
       'msvs_settings': {
         'VCCLCompilerTool': {
           'AdditionalOptions': [ '/std:c++17', '/EHsc'],
@@ -1 +1,147 @@
-module.exports = require('bindings')('addon')
+const path = require('path')
+const bindings = require('bindings')
+
+const addon = bindings('addon')
+const addonPath = bindings({ bindings: 'addon', path: true })
+
+const RANKS = ['2', '3', '4', '5', '6', '7', '8', '9', 'T', 'J', 'Q', 'K', 'A']
+const SUITS = ['clubs', 'diamonds', 'hearts', 'spades']
+const ROUNDS_OF_BETTING = ['preflop', 'flop', 'turn', 'river']
+
+// Layout of Table.prototype.snapshot. Keep in sync with src/Snapshot.h.
+const NUM_SEATS = 9
+const SEATS = 9
+const SEAT_STRIDE = 6
+const COMMUNITY_CARDS = SEATS + NUM_SEATS * SEAT_STRIDE
+const POTS = COMMUNITY_CARDS + 6
+
+// Converts a card encoded as rank * 4 + suit into a { rank, suit } object.
+function decodeCard(card) {
+    return { rank: RANKS[card >> 2], suit: SUITS[card & 3] }
+}
+
+// Converts a state written by Table.prototype.snapshot into plain objects.
+function decodeSnapshot(buffer) {
+    const seats = []
+    for (let i = 0; i < NUM_SEATS; ++i) {
+        const offset = SEATS + i * SEAT_STRIDE
+        if (!(buffer[offset] & 1)) {
+            seats.push(null)
+            continue
+        }
+        seats.push({
+            inHand: (buffer[offset] & 2) !== 0,
+            stackSize: buffer[offset + 1],
+            betSize: buffer[offset + 2],
+            totalChips: buffer[offset + 3],
+            holeCards: buffer[offset + 4] === -1 ? null : [buffer[offset + 4], buffer[offset + 5]]
+        })
+    }
+    const communityCards = []
+    for (let i = 0; i < buffer[COMMUNITY_CARDS]; ++i) {
+        communityCards.push(buffer[COMMUNITY_CARDS + 1 + i])
+    }
+    const pots = []
+    for (let i = 0; i < buffer[POTS]; ++i) {
+        const eligible = buffer[POTS + 2 + i * 2]
+        const eligiblePlayers = []
+        for (let j = 0; j < NUM_SEATS; ++j) {
+            if (eligible & (1 << j)) eligiblePlayers.push(j)
+        }
+        pots.push({ size: buffer[POTS + 1 + i * 2], eligiblePlayers })
+    }
+    return {
+        handInProgress: (buffer[1] & 1) !== 0,
+        bettingRoundInProgress: (buffer[1] & 2) !== 0,
+        bettingRoundsCompleted: (buffer[1] & 4) !== 0,
+        button: buffer[2],
+        playerToAct: buffer[3],
+        roundOfBetting: buffer[4] === -1 ? null : ROUNDS_OF_BETTING[buffer[4]],
+        numActivePlayers: buffer[5],
+        forcedBets: { ante: buffer[6], smallBlind: buffer[7], bigBlind: buffer[8] },
+        seats,
+        communityCards,
+        pots
+    }
+}
+
+const EVENT_TYPES = [
+    'resync', 'hand', 'roundOfBetting', 'cardDealt', 'seat', 'seatLeft', 'folded', 'pot', 'playerToAct', 'forcedBets'
+]
+
+// Converts count records drained by Table.prototype.drainEvents into plain objects.
+function decodeEvents(buffer, count) {
+    const events = []
+    for (let i = 0; i < count; ++i) {
+        const [type, a, b, c] = buffer.subarray(i * 4, i * 4 + 4)
+        switch (EVENT_TYPES[type]) {
+        case 'hand': events.push({ type: 'hand', inProgress: (a & 1) !== 0, button: b }); break
+        case 'roundOfBetting': events.push({ type: 'roundOfBetting', roundOfBetting: ROUNDS_OF_BETTING[a] }); break
+        case 'cardDealt': events.push({ type: 'cardDealt', position: a, card: b }); break
+        case 'seat': events.push({ type: 'seat', seatIndex: a, stackSize: b, betSize: c }); break
+        case 'seatLeft': events.push({ type: 'seatLeft', seatIndex: a }); break
+        case 'folded': events.push({ type: 'folded', seatIndex: a }); break
+        case 'pot': events.push({ type: 'pot', index: a, size: b, eligiblePlayersMask: c }); break
+        case 'playerToAct': events.push({ type: 'playerToAct', seatIndex: a }); break
+        case 'forcedBets': events.push({ type: 'forcedBets', ante: a, smallBlind: b, bigBlind: c }); break
+        default: events.push({ type: 'resync' })
+        }
+    }
+    return events
+}
+
+// Layout of poker.metrics(). Keep in sync with src/Metrics.h.
+const METRICS_HEADER_SIZE = 6
+const METRICS_METHOD_HEADER_SIZE = 3
+
+// Converts the array returned by poker.metrics() into plain objects. Histograms only list non-empty buckets as
+// [upper bound in nanoseconds, count] pairs.
+function decodeMetrics(buffer) {
+    const numMethods = buffer[2]
+    const numBuckets = buffer[3]
+    const elapsedSeconds = buffer[4] / 1e9
+    const methods = {}
+    for (let i = 0; i < numMethods; ++i) {
+        const offset = METRICS_HEADER_SIZE + i * (METRICS_METHOD_HEADER_SIZE + numBuckets)
+        const histogram = []
+        for (let b = 0; b < numBuckets; ++b) {
+            const count = buffer[offset + METRICS_METHOD_HEADER_SIZE + b]
+            if (count !== 0) {
+                histogram.push([addon.METRIC_BUCKET_BOUNDS[b], count])
+            }
+        }
+        methods[addon.METRIC_METHODS[i]] = {
+            calls: buffer[offset],
+            failures: buffer[offset + 1],
+            totalSeconds: buffer[offset + 2] / 1e9,
+            histogram
+        }
+    }
+    return {
+        enabled: buffer[1] === 1,
+        elapsedSeconds,
+        handsStarted: buffer[5],
+        handsPerSecond: buffer[5] / elapsedSeconds,
+        methods
+    }
+}
+
+const lookupPreflopEquity = addon.preflopEquity
+let preflopEquityTableLoaded = false
+
+// Looks up the heads-up preflop equity of hand against opponent, or against a random hand. The table is
+// memory-mapped from next to the addon on first use.
+function preflopEquity(hand, opponent) {
+    if (!preflopEquityTableLoaded) {
+        addon.loadPreflopEquityTable(path.join(path.dirname(addonPath), 'preflop_equity.bin'))
+        preflopEquityTableLoaded = true
+    }
+    return lookupPreflopEquity(hand, opponent)
+}
+
+module.exports = addon
+module.exports.decodeCard = decodeCard
+module.exports.decodeSnapshot = decodeSnapshot
+module.exports.decodeEvents = decodeEvents
+module.exports.decodeMetrics = decodeMetrics
+module.exports.preflopEquity = preflopEquity
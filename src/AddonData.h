@@ -0,0 +1,32 @@
+#ifndef ADDON_DATA_H
+#define ADDON_DATA_H
+
+#include <napi.h>
+
+#include <memory>
+
+#include "PreflopEquity.h"
+
+// State of the addon for one environment. The main thread and every worker thread which loads the addon get
+// their own instance through napi_set_instance_data, so that nothing mutable is shared between threads. It is
+// destroyed with the environment.
+struct AddonData {
+    Napi::FunctionReference table_constructor;
+
+    // Strings returned by the Table observers. They are created once by Table::Init, so returning an
+    // enumerator does not create a new string. Indices match the order of the enumerators.
+    Napi::Reference<Napi::Array> ranks;
+    Napi::Reference<Napi::Array> suits;
+    Napi::Reference<Napi::Array> rounds_of_betting;
+    Napi::Reference<Napi::Array> automatic_actions;
+    Napi::Reference<Napi::Array> actions;
+
+    // Set by poker.loadPreflopEquityTable.
+    std::unique_ptr<PreflopEquityTable> preflop_equity_table;
+};
+
+inline AddonData& GetAddonData(Napi::Env env) {
+    return *env.GetInstanceData<AddonData>();
+}
+
+#endif // ADDON_DATA_H
@@ -0,0 +1,77 @@
+#include "BoardTexture.h"
+
+#include <algorithm>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+
+inline std::int32_t Popcount(std::uint64_t mask) {
+#ifdef _MSC_VER
+    return static_cast<std::int32_t>(__popcnt64(mask));
+#else
+    return __builtin_popcountll(mask);
+#endif
+}
+
+} // namespace
+
+std::int32_t SuitCount(CardSet cards, std::int32_t suit) {
+    return Popcount((cards >> (suit * 16)) & 0x1fff);
+}
+
+std::int32_t CardCount(CardSet cards) {
+    return Popcount(cards);
+}
+
+BoardTexture AnalyzeBoard(CardSet board) {
+    auto texture = BoardTexture{};
+    texture.num_cards = CardCount(board);
+
+    const auto c = static_cast<std::uint32_t>(board) & 0x1fff;
+    const auto d = static_cast<std::uint32_t>(board >> 16) & 0x1fff;
+    const auto h = static_cast<std::uint32_t>(board >> 32) & 0x1fff;
+    const auto s = static_cast<std::uint32_t>(board >> 48) & 0x1fff;
+    texture.paired = ((c & (d | h | s)) | (d & (h | s)) | (h & s)) != 0;
+    texture.trips = ((c & d & (h | s)) | (h & s & (c | d))) != 0;
+
+    for (std::int32_t suit = 0; suit < 4; ++suit) {
+        texture.max_suited = std::max(texture.max_suited, SuitCount(board, suit));
+    }
+
+    // Bit 0 is the ace playing low, bits 1 to 13 the deuce to the ace.
+    const auto ranks = RankMask(board);
+    const auto low_ranks = (ranks << 1) | (ranks >> 12);
+    for (std::int32_t low = 0; low + 5 <= 14; ++low) {
+        texture.max_connected = std::max(texture.max_connected, Popcount((low_ranks >> low) & 0x1f));
+    }
+
+    // Players hold two cards, and the cards to come are 5 minus those on the board.
+    const auto to_come = std::max(0, 5 - texture.num_cards);
+    texture.flush_possible = texture.max_suited >= 3;
+    texture.straight_possible = texture.max_connected >= 3;
+    texture.flush_draw = texture.max_suited == 2 && to_come >= 1;
+    texture.straight_draw = texture.max_connected == 2 && to_come >= 1;
+    texture.backdoor_flush_draw = texture.max_suited == 1 && to_come >= 2;
+    texture.backdoor_straight_draw = texture.max_connected == 1 && to_come >= 2;
+    return texture;
+}
+
+CardSet Outs(CardSet hole, CardSet board) {
+    const auto known = hole | board;
+    const auto current = HandStrengthCategory(EvaluateHand(known));
+    auto outs = CardSet{0};
+    for (std::int32_t card = 0; card < num_cards; ++card) {
+        const auto bit = CardBit(card);
+        if (known & bit) {
+            continue;
+        }
+        const auto improved = HandStrengthCategory(EvaluateHand(known | bit));
+        if (improved > current && HandStrengthCategory(EvaluateHand(board | bit)) < improved) {
+            outs |= bit;
+        }
+    }
+    return outs;
+}
@@ -0,0 +1,38 @@
+#ifndef BOARD_TEXTURE_H
+#define BOARD_TEXTURE_H
+
+#include <cstdint>
+
+#include "HandEvaluator.h"
+
+// Ranks present in any suit of cards, as a 13-bit mask.
+constexpr std::uint32_t RankMask(CardSet cards) {
+    return static_cast<std::uint32_t>((cards | cards >> 16 | cards >> 32 | cards >> 48) & 0x1fff);
+}
+
+// Number of cards of a suit.
+std::int32_t SuitCount(CardSet cards, std::int32_t suit);
+
+std::int32_t CardCount(CardSet cards);
+
+struct BoardTexture {
+    std::int32_t num_cards = 0;
+    bool paired = false;                 // two or more cards share a rank
+    bool trips = false;                  // three or more cards share a rank
+    std::int32_t max_suited = 0;         // cards of the most common suit
+    std::int32_t max_connected = 0;      // most distinct ranks within a window of 5 consecutive ranks (ace plays low too)
+    bool flush_possible = false;         // a player can hold a flush
+    bool straight_possible = false;      // a player can hold a straight
+    bool flush_draw = false;             // a flush becomes possible with one more card of a suit
+    bool straight_draw = false;          // a straight becomes possible with one more card in rank
+    bool backdoor_flush_draw = false;    // a flush needs the next two cards, both of a suit
+    bool backdoor_straight_draw = false; // a straight needs the next two cards, both in rank
+};
+
+BoardTexture AnalyzeBoard(CardSet board);
+
+// Cards not in hole or board which improve the category of the best hand of hole and board, leaving out
+// those which give the board alone a hand of the same category or better.
+CardSet Outs(CardSet hole, CardSet board);
+
+#endif // BOARD_TEXTURE_H
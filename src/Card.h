@@ -0,0 +1,20 @@
+#ifndef CARD_H
+#define CARD_H
+
+#include <cstdint>
+
+#define POKER_THROW_ON_ERROR
+#include "poker/table.hpp"
+
+// Compact card encoding: rank * 4 + suit, where rank is 0 (deuce) to 12 (ace) and suit is 0 (clubs),
+// 1 (diamonds), 2 (hearts) or 3 (spades). Cards are therefore numbered 0..51.
+constexpr std::int32_t num_cards = 52;
+
+inline std::int32_t CardIndex(const poker::card& c) {
+    return static_cast<std::int32_t>(c.rank) * 4 + static_cast<std::int32_t>(c.suit);
+}
+
+constexpr std::int32_t CardRank(std::int32_t card) { return card >> 2; }
+constexpr std::int32_t CardSuit(std::int32_t card) { return card & 3; }
+
+#endif // CARD_H
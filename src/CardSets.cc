@@ -0,0 +1,124 @@
+#include "CardSets.h"
+
+#include "BoardTexture.h"
+#include "Conversions.h"
+
+CardSet ToCardSet(Napi::Env env, Napi::Value value) {
+    if (value.IsBigInt()) {
+        auto lossless = false;
+        const auto cards = value.As<Napi::BigInt>().Uint64Value(&lossless);
+        if (!lossless || (cards & ~CardSet{0x1fff1fff1fff1fff}) != 0) {
+            throw Napi::RangeError::New(env, "Invalid card set");
+        }
+        return cards;
+    }
+    auto cards = CardSet{0};
+    for (const auto card : ToCards(env, value)) {
+        cards |= CardBit(card);
+    }
+    return cards;
+}
+
+Napi::Object CardSets::Init(Napi::Env env, Napi::Object exports) {
+    exports.Set("cardSet", Napi::Function::New(env, &CardSets::ToSet, "cardSet"));
+    exports.Set("cardsOf", Napi::Function::New(env, &CardSets::ToCardArray, "cardsOf"));
+    exports.Set("boardTexture", Napi::Function::New(env, &CardSets::GetBoardTexture, "boardTexture"));
+    exports.Set("handCategory", Napi::Function::New(env, &CardSets::GetHandCategory, "handCategory"));
+    exports.Set("outs", Napi::Function::New(env, &CardSets::GetOuts, "outs"));
+
+    auto hand_category = Napi::Object::New(env);
+    hand_category.Set("HIGH_CARD", static_cast<int32_t>(HandCategory::high_card));
+    hand_category.Set("PAIR", static_cast<int32_t>(HandCategory::pair));
+    hand_category.Set("TWO_PAIR", static_cast<int32_t>(HandCategory::two_pair));
+    hand_category.Set("THREE_OF_A_KIND", static_cast<int32_t>(HandCategory::three_of_a_kind));
+    hand_category.Set("STRAIGHT", static_cast<int32_t>(HandCategory::straight));
+    hand_category.Set("FLUSH", static_cast<int32_t>(HandCategory::flush));
+    hand_category.Set("FULL_HOUSE", static_cast<int32_t>(HandCategory::full_house));
+    hand_category.Set("FOUR_OF_A_KIND", static_cast<int32_t>(HandCategory::four_of_a_kind));
+    hand_category.Set("STRAIGHT_FLUSH", static_cast<int32_t>(HandCategory::straight_flush));
+    exports.Set("HandCategory", hand_category);
+    return exports;
+}
+
+Napi::Value CardSets::ToSet(const Napi::CallbackInfo& info) try {
+    if (info.Length() != 1) {
+        throw Napi::TypeError::New(info.Env(), "Expected 1 argument");
+    }
+    return Napi::BigInt::New(info.Env(), static_cast<std::uint64_t>(ToCardSet(info.Env(), info[0])));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value CardSets::ToCardArray(const Napi::CallbackInfo& info) try {
+    auto env = info.Env();
+    if (info.Length() != 1) {
+        throw Napi::TypeError::New(env, "Expected 1 argument");
+    }
+    const auto cards = ToCardSet(env, info[0]);
+    auto array = Napi::Array::New(env, CardCount(cards));
+    auto i = 0u;
+    for (std::int32_t card = 0; card < num_cards; ++card) {
+        if (cards & CardBit(card)) {
+            array.Set(i++, Napi::Number::New(env, card));
+        }
+    }
+    return array;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value CardSets::GetBoardTexture(const Napi::CallbackInfo& info) try {
+    auto env = info.Env();
+    if (info.Length() != 1) {
+        throw Napi::TypeError::New(env, "Expected 1 argument");
+    }
+    const auto board = ToCardSet(env, info[0]);
+    if (CardCount(board) > 5) {
+        throw Napi::RangeError::New(env, "A board has at most 5 cards");
+    }
+    const auto texture = AnalyzeBoard(board);
+    auto obj = Napi::Object::New(env);
+    obj.Set("numCards", Napi::Number::New(env, texture.num_cards));
+    obj.Set("paired", Napi::Boolean::New(env, texture.paired));
+    obj.Set("trips", Napi::Boolean::New(env, texture.trips));
+    obj.Set("maxSuited", Napi::Number::New(env, texture.max_suited));
+    obj.Set("maxConnected", Napi::Number::New(env, texture.max_connected));
+    obj.Set("flushPossible", Napi::Boolean::New(env, texture.flush_possible));
+    obj.Set("straightPossible", Napi::Boolean::New(env, texture.straight_possible));
+    obj.Set("flushDraw", Napi::Boolean::New(env, texture.flush_draw));
+    obj.Set("straightDraw", Napi::Boolean::New(env, texture.straight_draw));
+    obj.Set("backdoorFlushDraw", Napi::Boolean::New(env, texture.backdoor_flush_draw));
+    obj.Set("backdoorStraightDraw", Napi::Boolean::New(env, texture.backdoor_straight_draw));
+    return obj;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value CardSets::GetHandCategory(const Napi::CallbackInfo& info) try {
+    auto env = info.Env();
+    if (info.Length() != 1) {
+        throw Napi::TypeError::New(env, "Expected 1 argument");
+    }
+    const auto cards = ToCardSet(env, info[0]);
+    if (CardCount(cards) > 7) {
+        throw Napi::RangeError::New(env, "A hand has at most 7 cards");
+    }
+    return Napi::Number::New(env, static_cast<std::int32_t>(HandStrengthCategory(EvaluateHand(cards))));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value CardSets::GetOuts(const Napi::CallbackInfo& info) try {
+    auto env = info.Env();
+    if (info.Length() != 2) {
+        throw Napi::TypeError::New(env, "Expected 2 arguments: (holeCards, board)");
+    }
+    const auto hole = ToCardSet(env, info[0]);
+    const auto board = ToCardSet(env, info[1]);
+    if (CardCount(hole) != 2 || CardCount(board) > 4 || (hole & board) != 0) {
+        throw Napi::RangeError::New(env, "Expected 2 hole cards and a board of at most 4 other cards");
+    }
+    return Napi::BigInt::New(env, static_cast<std::uint64_t>(Outs(hole, board)));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
@@ -0,0 +1,25 @@
+#ifndef CARD_SETS_H
+#define CARD_SETS_H
+
+#include <napi.h>
+
+#include "HandEvaluator.h"
+
+// Exposes card sets as BigInt bitmasks (see HandEvaluator.h for the layout) and the bitwise helpers working
+// on them.
+class CardSets {
+public:
+    static Napi::Object Init(Napi::Env env, Napi::Object exports);
+
+private:
+    static Napi::Value ToSet(const Napi::CallbackInfo& info);
+    static Napi::Value ToCardArray(const Napi::CallbackInfo& info);
+    static Napi::Value GetBoardTexture(const Napi::CallbackInfo& info);
+    static Napi::Value GetHandCategory(const Napi::CallbackInfo& info);
+    static Napi::Value GetOuts(const Napi::CallbackInfo& info);
+};
+
+// Converts a BigInt card set or an array of cards (see ToCard) into a card set.
+CardSet ToCardSet(Napi::Env env, Napi::Value value);
+
+#endif // CARD_SETS_H
@@ -0,0 +1,142 @@
+#ifndef COMMAND_H
+#define COMMAND_H
+
+#include <cstdint>
+#include <stdexcept>
+
+#define POKER_THROW_ON_ERROR
+#include "poker/table.hpp"
+
+#include "Rng.h"
+
+// Packed table commands. A command is an opcode followed by two integer arguments:
+//   sit_down           seat index, buy-in
+//   stand_up           seat index, -
+//   start_hand         button seat index (-1 to let the table move the button), -
+//   action_taken       action code, bet size (for bet and raise)
+//   end_betting_round  -, -
+//   showdown           -, -
+enum class Opcode : std::int32_t {
+    sit_down,
+    stand_up,
+    start_hand,
+    action_taken,
+    end_betting_round,
+    showdown
+};
+
+// Integer action codes used by packed commands.
+enum class ActionCode : std::int32_t {
+    fold,
+    check,
+    call,
+    bet,
+    raise
+};
+
+inline poker::action ToAction(std::int32_t code) {
+    switch (static_cast<ActionCode>(code)) {
+    case ActionCode::fold:  return poker::action::fold;
+    case ActionCode::check: return poker::action::check;
+    case ActionCode::call:  return poker::action::call;
+    case ActionCode::bet:   return poker::action::bet;
+    case ActionCode::raise: return poker::action::raise;
+    default: throw std::invalid_argument{"Invalid action code"};
+    }
+}
+
+inline ActionCode ToActionCode(poker::action action) {
+    switch (action) {
+    case poker::action::fold:  return ActionCode::fold;
+    case poker::action::check: return ActionCode::check;
+    case poker::action::call:  return ActionCode::call;
+    case poker::action::bet:   return ActionCode::bet;
+    case poker::action::raise: return ActionCode::raise;
+    default: throw std::invalid_argument{"Invalid action"};
+    }
+}
+
+// Bit ActionCode of the mask is set for every legal action.
+inline std::int32_t LegalActionMask(const poker::dealer::action_range& legal) {
+    auto mask = std::int32_t{0};
+    for (const auto code : { ActionCode::fold, ActionCode::check, ActionCode::call, ActionCode::bet, ActionCode::raise }) {
+        if (static_cast<bool>(legal.action & ToAction(static_cast<std::int32_t>(code)))) {
+            mask |= 1 << static_cast<std::int32_t>(code);
+        }
+    }
+    return mask;
+}
+
+// Outcome of checking an action before it is taken.
+enum class ActionStatus : std::int32_t {
+    ok,
+    no_betting_round,
+    invalid_action_code,
+    illegal_action,
+    invalid_bet_size
+};
+
+// Tells whether the player to act may take an action, without relying on the exceptions thrown by the table.
+inline ActionStatus CheckAction(const poker::table& table, std::int32_t code, std::int32_t bet) {
+    if (!table.hand_in_progress() || !table.betting_round_in_progress()) {
+        return ActionStatus::no_betting_round;
+    }
+    if (code < static_cast<std::int32_t>(ActionCode::fold) || code > static_cast<std::int32_t>(ActionCode::raise)) {
+        return ActionStatus::invalid_action_code;
+    }
+    const auto legal = table.legal_actions();
+    const auto action = ToAction(code);
+    if (!static_cast<bool>(legal.action & action)) {
+        return ActionStatus::illegal_action;
+    }
+    if ((action == poker::action::bet || action == poker::action::raise)
+        && (bet < static_cast<std::int32_t>(legal.chip_range.min) || bet > static_cast<std::int32_t>(legal.chip_range.max))) {
+        return ActionStatus::invalid_bet_size;
+    }
+    return ActionStatus::ok;
+}
+
+template<class URBG>
+void ApplyCommand(poker::table& table, URBG& rng, std::int32_t opcode, std::int32_t arg0, std::int32_t arg1) {
+    switch (static_cast<Opcode>(opcode)) {
+    case Opcode::sit_down:
+        table.sit_down(arg0, arg1);
+        break;
+    case Opcode::stand_up:
+        table.stand_up(arg0);
+        break;
+    case Opcode::start_hand:
+        if (arg0 < -1 || arg0 >= static_cast<std::int32_t>(poker::table::num_seats)) {
+            throw std::out_of_range{"Invalid seat index for button"};
+        }
+        if (arg0 == -1) {
+            table.start_hand(rng);
+        } else {
+            table.start_hand(rng, arg0);
+        }
+        break;
+    case Opcode::action_taken: {
+        const auto action = ToAction(arg0);
+        if (action == poker::action::bet || action == poker::action::raise) {
+            table.action_taken(action, arg1);
+        } else {
+            table.action_taken(action);
+        }
+        break;
+    }
+    case Opcode::end_betting_round:
+        table.end_betting_round();
+        break;
+    case Opcode::showdown:
+        table.showdown();
+        break;
+    default:
+        throw std::invalid_argument{"Invalid command opcode"};
+    }
+}
+
+inline void ApplyCommand(poker::table& table, Rng& rng, std::int32_t opcode, std::int32_t arg0, std::int32_t arg1) {
+    rng.Visit([&](auto& engine) { ApplyCommand(table, engine, opcode, arg0, arg1); });
+}
+
+#endif // COMMAND_H
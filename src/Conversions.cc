@@ -0,0 +1,183 @@
+#include "Conversions.h"
+
+#include <bitset>
+#include <sstream>
+#include <string>
+
+#include "Card.h"
+#include "PreflopEquity.h"
+
+namespace {
+
+std::int32_t ParseRank(const std::string& rank) {
+    constexpr const char* rank_strings[] = { "2", "3", "4", "5", "6", "7", "8", "9", "T", "J", "Q", "K", "A" };
+    for (std::int32_t i = 0; i < 13; ++i) {
+        if (rank == rank_strings[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+std::int32_t ParseSuit(const std::string& suit) {
+    constexpr const char* suit_strings[] = { "clubs", "diamonds", "hearts", "spades" };
+    constexpr const char suit_letters[] = { 'c', 'd', 'h', 's' };
+    for (std::int32_t i = 0; i < 4; ++i) {
+        if (suit == suit_strings[i] || (suit.size() == 1 && suit[0] == suit_letters[i])) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+std::bitset<num_hand_classes> ToHandClasses(Napi::Env env, Napi::Value value) {
+    auto names = std::vector<std::string>{};
+    if (value.IsString()) {
+        auto stream = std::istringstream{value.As<Napi::String>().Utf8Value()};
+        for (std::string name; std::getline(stream, name, ',');) {
+            const auto begin = name.find_first_not_of(' ');
+            const auto end = name.find_last_not_of(' ');
+            if (begin != std::string::npos) {
+                names.push_back(name.substr(begin, end - begin + 1));
+            }
+        }
+    } else if (value.IsArray()) {
+        auto arr = value.As<Napi::Array>();
+        for (std::uint32_t i = 0; i < arr.Length(); ++i) {
+            if (!arr.Get(i).IsString()) {
+                throw Napi::TypeError::New(env, "Invalid range: expected hand class names");
+            }
+            names.push_back(arr.Get(i).As<Napi::String>().Utf8Value());
+        }
+    } else if (!value.IsUndefined()) {
+        throw Napi::TypeError::New(env, "Invalid range: expected String or Array");
+    }
+
+    auto classes = std::bitset<num_hand_classes>{};
+    for (const auto& name : names) {
+        const auto hand_class = ParseHandClass(name);
+        if (hand_class < 0) {
+            throw Napi::TypeError::New(env, "Invalid hand class: " + name);
+        }
+        classes.set(static_cast<std::size_t>(hand_class));
+    }
+    return classes;
+}
+
+double ToWeight(Napi::Object obj, const char* key, double default_value) {
+    if (!obj.Has(key)) {
+        return default_value;
+    }
+    if (!obj.Get(key).IsNumber()) {
+        throw Napi::TypeError::New(obj.Env(), std::string{"Invalid policy: expected a Number for "} + key);
+    }
+    return obj.Get(key).As<Napi::Number>().DoubleValue();
+}
+
+} // namespace
+
+std::string_view ToStringView(Napi::Value value, char (&buffer)[16]) {
+    auto length = std::size_t{0};
+    if (napi_get_value_string_utf8(value.Env(), value, buffer, sizeof(buffer), &length) != napi_ok) {
+        throw Napi::Error::New(value.Env());
+    }
+    return {buffer, length};
+}
+
+std::int32_t ToCard(Napi::Env env, Napi::Value value) {
+    auto card = std::int32_t{-1};
+    if (value.IsNumber()) {
+        card = value.As<Napi::Number>().Int32Value();
+        if (card < 0 || card >= num_cards) {
+            card = -1;
+        }
+    } else if (value.IsString()) {
+        const auto s = value.As<Napi::String>().Utf8Value();
+        if (s.size() == 2) {
+            const auto rank = ParseRank(s.substr(0, 1));
+            const auto suit = ParseSuit(s.substr(1, 1));
+            if (rank != -1 && suit != -1) {
+                card = rank * 4 + suit;
+            }
+        }
+    } else if (value.IsObject()) {
+        auto obj = value.As<Napi::Object>();
+        if (obj.Get("rank").IsString() && obj.Get("suit").IsString()) {
+            const auto rank = ParseRank(obj.Get("rank").As<Napi::String>().Utf8Value());
+            const auto suit = ParseSuit(obj.Get("suit").As<Napi::String>().Utf8Value());
+            if (rank != -1 && suit != -1) {
+                card = rank * 4 + suit;
+            }
+        }
+    }
+    if (card == -1) {
+        throw Napi::TypeError::New(env, "Invalid card");
+    }
+    return card;
+}
+
+std::vector<std::int32_t> ToCards(Napi::Env env, Napi::Value value) {
+    if (!value.IsArray()) {
+        throw Napi::TypeError::New(env, "Expected an Array of cards");
+    }
+    auto array = value.As<Napi::Array>();
+    auto cards = std::vector<std::int32_t>{};
+    for (uint32_t i = 0; i < array.Length(); ++i) {
+        cards.push_back(ToCard(env, array.Get(i)));
+    }
+    return cards;
+}
+
+std::array<std::int32_t, 2> ToHoleCards(Napi::Env env, Napi::Value value) {
+    if (value.IsArray()) {
+        auto array = value.As<Napi::Array>();
+        if (array.Length() == 2) {
+            return {ToCard(env, array.Get(0u)), ToCard(env, array.Get(1u))};
+        }
+    } else if (value.IsObject()) {
+        auto obj = value.As<Napi::Object>();
+        return {ToCard(env, obj.Get("first")), ToCard(env, obj.Get("second"))};
+    }
+    throw Napi::TypeError::New(env, "Invalid hole cards");
+}
+
+Policy ToPolicy(Napi::Env env, Napi::Value value) {
+    auto policy = Policy{};
+    if (value.IsString()) {
+        const auto name = value.As<Napi::String>().Utf8Value();
+        if (name == "checkCall") policy.kind = Policy::Kind::check_call;
+        else if (name == "foldToRaise") policy.kind = Policy::Kind::fold_to_raise;
+        else throw Napi::TypeError::New(env, "Invalid policy: " + name);
+    } else if (value.IsObject()) {
+        auto obj = value.As<Napi::Object>();
+        const auto type = obj.Get("type").IsString() ? obj.Get("type").As<Napi::String>().Utf8Value() : std::string{};
+        if (type == "mix") {
+            policy.kind = Policy::Kind::mix;
+            policy.fold_weight = ToWeight(obj, "fold", 0.0);
+            policy.passive_weight = ToWeight(obj, "call", 0.0);
+            policy.aggressive_weight = ToWeight(obj, "raise", 0.0);
+            if (policy.fold_weight < 0 || policy.passive_weight < 0 || policy.aggressive_weight < 0
+                || policy.fold_weight + policy.passive_weight + policy.aggressive_weight <= 0) {
+                throw Napi::RangeError::New(env, "Invalid policy: weights must be non-negative and not all zero");
+            }
+        } else if (type == "equity") {
+            policy.kind = Policy::Kind::equity_threshold;
+            policy.call_equity = ToWeight(obj, "call", 0.0);
+            policy.raise_equity = ToWeight(obj, "raise", 1.0);
+            const auto iterations = ToWeight(obj, "iterations", policy.equity_iterations);
+            if (iterations < 1) {
+                throw Napi::RangeError::New(env, "Invalid policy: iterations must be positive");
+            }
+            policy.equity_iterations = static_cast<std::uint32_t>(iterations);
+        } else if (type == "range") {
+            policy.kind = Policy::Kind::range;
+            policy.raise_range = ToHandClasses(env, obj.Get("raise"));
+            policy.call_range = ToHandClasses(env, obj.Get("call"));
+        } else {
+            throw Napi::TypeError::New(env, "Invalid policy: expected type 'mix', 'equity' or 'range'");
+        }
+    } else {
+        throw Napi::TypeError::New(env, "Invalid policy: expected String or Object");
+    }
+    return policy;
+}
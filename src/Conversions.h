@@ -0,0 +1,32 @@
+#ifndef CONVERSIONS_H
+#define CONVERSIONS_H
+
+#include <napi.h>
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "Policy.h"
+
+// Reads a short string argument into buffer without allocating. Longer strings are truncated, so they never
+// compare equal to any of the names they are matched against.
+std::string_view ToStringView(Napi::Value value, char (&buffer)[16]);
+
+// Converts a card given as an encoded Number (0..51), a { rank, suit } object or a string such as "Ah" or
+// "Td" into its encoded form.
+std::int32_t ToCard(Napi::Env env, Napi::Value value);
+
+// Converts an array of cards.
+std::vector<std::int32_t> ToCards(Napi::Env env, Napi::Value value);
+
+// Converts hole cards given as a [first, second] array or a { first, second } object.
+std::array<std::int32_t, 2> ToHoleCards(Napi::Env env, Napi::Value value);
+
+// Converts a policy given as 'checkCall', 'foldToRaise', { type: 'mix', fold, call, raise },
+// { type: 'equity', call, raise, iterations } or { type: 'range', raise, call }. Ranges are arrays of hand
+// classes such as "AKs" or a single comma-separated string.
+Policy ToPolicy(Napi::Env env, Napi::Value value);
+
+#endif // CONVERSIONS_H
@@ -0,0 +1,280 @@
+#include "Equity.h"
+
+#include <algorithm>
+#include <exception>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+#include "Rng.h"
+
+namespace {
+
+struct Tally {
+    explicit Tally(std::size_t num_players) : wins(num_players), ties(num_players), shares(num_players) {}
+
+    std::vector<std::uint64_t> wins;
+    std::vector<std::uint64_t> ties;
+    std::vector<double> shares;
+    std::uint64_t num_boards = 0;
+};
+
+class Showdown {
+public:
+    Showdown(const std::vector<CardSet>& hands, Tally& tally) : _hands(hands), _tally(tally), _winners(hands.size()) {}
+
+    void operator()(CardSet board) {
+        auto best = std::uint32_t{0};
+        auto num_winners = std::size_t{0};
+        for (std::size_t p = 0; p < _hands.size(); ++p) {
+            const auto strength = EvaluateHand(_hands[p] | board);
+            if (strength > best) {
+                best = strength;
+                num_winners = 0;
+            }
+            if (strength == best) {
+                _winners[num_winners++] = p;
+            }
+        }
+        if (num_winners == 1) {
+            ++_tally.wins[_winners[0]];
+            _tally.shares[_winners[0]] += 1.0;
+        } else {
+            const auto share = 1.0 / static_cast<double>(num_winners);
+            for (std::size_t i = 0; i < num_winners; ++i) {
+                ++_tally.ties[_winners[i]];
+                _tally.shares[_winners[i]] += share;
+            }
+        }
+        ++_tally.num_boards;
+    }
+
+private:
+    const std::vector<CardSet>& _hands;
+    Tally& _tally;
+    std::vector<std::size_t> _winners;
+};
+
+std::uint64_t NumCombinations(std::uint64_t n, std::uint64_t k) {
+    auto result = std::uint64_t{1};
+    for (std::uint64_t i = 1; i <= k; ++i) {
+        result = result * (n - k + i) / i;
+    }
+    return result;
+}
+
+// Evaluates the k-card completions at positions first to last - 1 in lexicographic order, so that threads
+// can split the combinations into contiguous ranges instead of each walking all of them.
+void Enumerate(const std::vector<std::int32_t>& deck, std::size_t k, CardSet board, std::uint64_t first,
+               std::uint64_t last, Showdown& showdown) {
+    if (first >= last) {
+        return;
+    }
+    // Find the combination at position first by skipping, for each index, the combinations which start with
+    // a smaller card.
+    auto indices = std::vector<std::size_t>(k);
+    auto rank = first;
+    auto next = std::size_t{0};
+    for (std::size_t i = 0; i < k; ++i) {
+        for (;;) {
+            const auto skipped = NumCombinations(deck.size() - next - 1, k - i - 1);
+            if (skipped > rank) {
+                break;
+            }
+            rank -= skipped;
+            ++next;
+        }
+        indices[i] = next++;
+    }
+    for (auto position = first; position < last; ++position) {
+        auto completion = board;
+        for (const auto index : indices) {
+            completion |= CardBit(deck[index]);
+        }
+        showdown(completion);
+        // Advance to the next combination.
+        auto i = k;
+        while (i > 0 && indices[i - 1] == deck.size() - k + i - 1) {
+            --i;
+        }
+        if (i == 0) {
+            return;
+        }
+        ++indices[i - 1];
+        for (auto j = i; j < k; ++j) {
+            indices[j] = indices[j - 1] + 1;
+        }
+    }
+}
+
+void Sample(std::vector<std::int32_t> deck, std::size_t k, CardSet board, std::uint64_t iterations,
+            std::uint64_t seed, unsigned stream, Showdown& showdown) {
+    auto rng = Xoshiro256{seed};
+    for (unsigned i = 0; i < stream; ++i) {
+        rng.Jump();
+    }
+    for (std::uint64_t n = 0; n < iterations; ++n) {
+        auto completion = board;
+        for (std::size_t j = 0; j < k; ++j) {
+            const auto r = std::uniform_int_distribution<std::size_t>{j, deck.size() - 1}(rng);
+            std::swap(deck[j], deck[r]);
+            completion |= CardBit(deck[j]);
+        }
+        showdown(completion);
+    }
+}
+
+} // namespace
+
+EquityResult ComputeEquity(const std::vector<std::array<std::int32_t, 2>>& hole_cards,
+                           const std::vector<std::int32_t>& board, std::uint64_t max_iterations,
+                           unsigned num_threads, std::uint64_t seed) {
+    if (hole_cards.size() < 2) {
+        throw std::invalid_argument{"At least 2 players are required"};
+    }
+    if (board.size() > 5) {
+        throw std::invalid_argument{"The board can have at most 5 cards"};
+    }
+    if (num_threads == 0) {
+        throw std::invalid_argument{"Number of threads must be positive"};
+    }
+
+    auto dead = CardSet{0};
+    const auto add = [&](std::int32_t card) {
+        if (card < 0 || card >= num_cards) {
+            throw std::invalid_argument{"Invalid card"};
+        }
+        if (dead & CardBit(card)) {
+            throw std::invalid_argument{"Duplicate card"};
+        }
+        dead |= CardBit(card);
+    };
+    auto hands = std::vector<CardSet>{};
+    for (const auto& hc : hole_cards) {
+        add(hc[0]);
+        add(hc[1]);
+        hands.push_back(CardBit(hc[0]) | CardBit(hc[1]));
+    }
+    auto board_set = CardSet{0};
+    for (const auto card : board) {
+        add(card);
+        board_set |= CardBit(card);
+    }
+    auto deck = std::vector<std::int32_t>{};
+    for (std::int32_t card = 0; card < num_cards; ++card) {
+        if (!(dead & CardBit(card))) {
+            deck.push_back(card);
+        }
+    }
+
+    const auto k = 5 - board.size();
+    if (deck.size() < k) {
+        throw std::invalid_argument{"Not enough cards left to complete the board"};
+    }
+    const auto num_completions = NumCombinations(deck.size(), k);
+    const auto exhaustive = num_completions <= max_iterations;
+    num_threads = static_cast<unsigned>(std::min<std::uint64_t>(num_threads, std::max<std::uint64_t>(1, max_iterations)));
+
+    auto tallies = std::vector<Tally>(num_threads, Tally{hands.size()});
+    auto errors = std::vector<std::exception_ptr>(num_threads);
+    auto threads = std::vector<std::thread>{};
+    for (unsigned t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            try {
+                auto showdown = Showdown{hands, tallies[t]};
+                if (exhaustive) {
+                    Enumerate(deck, k, board_set, num_completions * t / num_threads,
+                              num_completions * (t + 1) / num_threads, showdown);
+                } else {
+                    const auto share = max_iterations / num_threads + (t < max_iterations % num_threads ? 1 : 0);
+                    Sample(deck, k, board_set, share, seed, t, showdown);
+                }
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto total = Tally{hands.size()};
+    for (unsigned t = 0; t < num_threads; ++t) {
+        if (errors[t]) {
+            std::rethrow_exception(errors[t]);
+        }
+        for (std::size_t p = 0; p < hands.size(); ++p) {
+            total.wins[p] += tallies[t].wins[p];
+            total.ties[p] += tallies[t].ties[p];
+            total.shares[p] += tallies[t].shares[p];
+        }
+        total.num_boards += tallies[t].num_boards;
+    }
+
+    auto result = EquityResult{};
+    result.num_boards = total.num_boards;
+    result.exhaustive = exhaustive;
+    const auto n = static_cast<double>(std::max<std::uint64_t>(1, total.num_boards));
+    for (std::size_t p = 0; p < hands.size(); ++p) {
+        result.win.push_back(static_cast<double>(total.wins[p]) / n);
+        result.tie.push_back(static_cast<double>(total.ties[p]) / n);
+        result.equity.push_back(total.shares[p] / n);
+    }
+    return result;
+}
+
+double EstimateEquityVsRandom(const std::array<std::int32_t, 2>& hole_cards, const std::vector<std::int32_t>& board,
+                              std::size_t num_opponents, std::uint64_t iterations, std::uint64_t seed) {
+    if (board.size() > 5) {
+        throw std::invalid_argument{"The board can have at most 5 cards"};
+    }
+    auto dead = CardBit(hole_cards[0]) | CardBit(hole_cards[1]);
+    auto board_set = CardSet{0};
+    for (const auto card : board) {
+        board_set |= CardBit(card);
+    }
+    dead |= board_set;
+    auto deck = std::vector<std::int32_t>{};
+    for (std::int32_t card = 0; card < num_cards; ++card) {
+        if (!(dead & CardBit(card))) {
+            deck.push_back(card);
+        }
+    }
+    const auto k = 5 - board.size();
+    const auto num_drawn = 2 * num_opponents + k;
+    if (deck.size() < num_drawn) {
+        throw std::invalid_argument{"Not enough cards left to deal to every opponent"};
+    }
+    if (iterations == 0) {
+        return 0.0;
+    }
+
+    auto rng = Xoshiro256{seed};
+    const auto hand = CardBit(hole_cards[0]) | CardBit(hole_cards[1]);
+    auto shares = 0.0;
+    for (std::uint64_t n = 0; n < iterations; ++n) {
+        for (std::size_t j = 0; j < num_drawn; ++j) {
+            const auto r = std::uniform_int_distribution<std::size_t>{j, deck.size() - 1}(rng);
+            std::swap(deck[j], deck[r]);
+        }
+        auto completion = board_set;
+        for (std::size_t j = 2 * num_opponents; j < num_drawn; ++j) {
+            completion |= CardBit(deck[j]);
+        }
+        const auto strength = EvaluateHand(hand | completion);
+        auto num_tied = 1;
+        auto lost = false;
+        for (std::size_t o = 0; o < num_opponents && !lost; ++o) {
+            const auto opponent = EvaluateHand(CardBit(deck[2 * o]) | CardBit(deck[2 * o + 1]) | completion);
+            if (opponent > strength) {
+                lost = true;
+            } else if (opponent == strength) {
+                ++num_tied;
+            }
+        }
+        if (!lost) {
+            shares += 1.0 / num_tied;
+        }
+    }
+    return shares / static_cast<double>(iterations);
+}
@@ -0,0 +1,31 @@
+#ifndef EQUITY_H
+#define EQUITY_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "HandEvaluator.h"
+
+struct EquityResult {
+    std::vector<double> win;    // probability of winning outright
+    std::vector<double> tie;    // probability of splitting the pot
+    std::vector<double> equity; // expected share of the pot
+    std::uint64_t num_boards = 0;
+    bool exhaustive = false;
+};
+
+// Computes the equity of every player given their hole cards and a board of 0 to 5 cards. All board
+// completions are enumerated when there are at most max_iterations of them; otherwise max_iterations
+// boards are sampled. The work is split across num_threads threads.
+EquityResult ComputeEquity(const std::vector<std::array<std::int32_t, 2>>& hole_cards,
+                           const std::vector<std::int32_t>& board, std::uint64_t max_iterations,
+                           unsigned num_threads, std::uint64_t seed);
+
+// Estimates the equity of hole_cards against num_opponents random hands by sampling iterations deals of the
+// opponents' hole cards and the rest of the board. Runs on the calling thread; cheap enough to be used for a
+// single decision with a few hundred iterations.
+double EstimateEquityVsRandom(const std::array<std::int32_t, 2>& hole_cards, const std::vector<std::int32_t>& board,
+                              std::size_t num_opponents, std::uint64_t iterations, std::uint64_t seed);
+
+#endif // EQUITY_H
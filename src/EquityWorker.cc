@@ -0,0 +1,105 @@
+#include "EquityWorker.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+#include "Conversions.h"
+#include "Rng.h"
+
+Napi::Object EquityWorker::Init(Napi::Env env, Napi::Object exports) {
+    exports.Set("equity", Napi::Function::New(env, &EquityWorker::Equity, "equity"));
+    return exports;
+}
+
+Napi::Value EquityWorker::Equity(const Napi::CallbackInfo& info) try {
+    auto env = info.Env();
+    if (info.Length() < 2 || !info[0].IsArray()) {
+        throw Napi::TypeError::New(env, "Expected arguments: (holeCardsPerPlayer, board[, options])");
+    }
+
+    auto players = info[0].As<Napi::Array>();
+    auto hole_cards = std::vector<std::array<std::int32_t, 2>>{};
+    for (uint32_t i = 0; i < players.Length(); ++i) {
+        hole_cards.push_back(ToHoleCards(env, players.Get(i)));
+    }
+    auto board = info[1].IsUndefined() || info[1].IsNull() ? std::vector<std::int32_t>{} : ToCards(env, info[1]);
+
+    auto iterations = std::uint64_t{1000000};
+    auto num_threads = std::max(1u, std::thread::hardware_concurrency());
+    auto seed = RandomSeed();
+    if (info.Length() > 2 && info[2].IsObject()) {
+        auto options = info[2].As<Napi::Object>();
+        if (options.Get("iterations").IsNumber()) {
+            const auto value = options.Get("iterations").As<Napi::Number>().Int64Value();
+            if (value < 1) {
+                throw Napi::RangeError::New(env, "iterations must be positive");
+            }
+            iterations = static_cast<std::uint64_t>(value);
+        }
+        if (options.Get("threads").IsNumber()) {
+            const auto value = options.Get("threads").As<Napi::Number>().Int32Value();
+            if (value < 1) {
+                throw Napi::RangeError::New(env, "threads must be positive");
+            }
+            num_threads = static_cast<unsigned>(value);
+        }
+        if (options.Get("seed").IsNumber()) {
+            seed = static_cast<std::uint64_t>(options.Get("seed").As<Napi::Number>().Int64Value());
+        }
+    }
+
+    auto worker = new EquityWorker(env, std::move(hole_cards), std::move(board), iterations, num_threads, seed);
+    auto promise = worker->GetPromise();
+    worker->Queue();
+    return promise;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+EquityWorker::EquityWorker(Napi::Env env, std::vector<std::array<std::int32_t, 2>> hole_cards,
+                           std::vector<std::int32_t> board, std::uint64_t iterations, unsigned num_threads,
+                           std::uint64_t seed)
+    : Napi::AsyncWorker(env)
+    , _deferred(Napi::Promise::Deferred::New(env))
+    , _hole_cards(std::move(hole_cards))
+    , _board(std::move(board))
+    , _iterations(iterations)
+    , _num_threads(num_threads)
+    , _seed(seed)
+{
+}
+
+Napi::Promise EquityWorker::GetPromise() const {
+    return _deferred.Promise();
+}
+
+void EquityWorker::Execute() {
+    try {
+        _result = ComputeEquity(_hole_cards, _board, _iterations, _num_threads, _seed);
+    } catch (const std::exception& e) {
+        SetError(e.what());
+    }
+}
+
+void EquityWorker::OnOK() {
+    auto env = Env();
+    const auto to_array = [&](const std::vector<double>& values) {
+        auto array = Napi::Array::New(env, values.size());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            array.Set(i, Napi::Number::New(env, values[i]));
+        }
+        return array;
+    };
+    auto obj = Napi::Object::New(env);
+    obj.Set("win", to_array(_result.win));
+    obj.Set("tie", to_array(_result.tie));
+    obj.Set("equity", to_array(_result.equity));
+    obj.Set("boards", Napi::Number::New(env, static_cast<double>(_result.num_boards)));
+    obj.Set("exhaustive", Napi::Boolean::New(env, _result.exhaustive));
+    _deferred.Resolve(obj);
+}
+
+void EquityWorker::OnError(const Napi::Error& e) {
+    _deferred.Reject(e.Value());
+}
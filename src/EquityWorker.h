@@ -0,0 +1,34 @@
+#ifndef EQUITY_WORKER_H
+#define EQUITY_WORKER_H
+
+#include <napi.h>
+
+#include "Equity.h"
+
+// Computes hand equities off the JS thread and resolves a Promise with the win/tie probabilities.
+class EquityWorker : public Napi::AsyncWorker {
+public:
+    static Napi::Object Init(Napi::Env env, Napi::Object exports);
+    static Napi::Value Equity(const Napi::CallbackInfo& info);
+
+    EquityWorker(Napi::Env env, std::vector<std::array<std::int32_t, 2>> hole_cards, std::vector<std::int32_t> board,
+                 std::uint64_t iterations, unsigned num_threads, std::uint64_t seed);
+
+    Napi::Promise GetPromise() const;
+
+protected:
+    void Execute() override;
+    void OnOK() override;
+    void OnError(const Napi::Error& e) override;
+
+private:
+    Napi::Promise::Deferred _deferred;
+    std::vector<std::array<std::int32_t, 2>> _hole_cards;
+    std::vector<std::int32_t> _board;
+    std::uint64_t _iterations;
+    unsigned _num_threads;
+    std::uint64_t _seed;
+    EquityResult _result;
+};
+
+#endif // EQUITY_WORKER_H
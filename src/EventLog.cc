@@ -0,0 +1,103 @@
+#include "EventLog.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+EventLog::EventLog(const poker::table& table, std::size_t capacity)
+    : _records(capacity * record_size)
+    , _capacity(capacity)
+{
+    if (capacity == 0) {
+        throw std::invalid_argument{"Event log capacity must be positive"};
+    }
+    WriteSnapshot(table, _previous.data());
+}
+
+void EventLog::Record(const poker::table& table) {
+    using namespace snapshot;
+
+    WriteSnapshot(table, _current.data());
+    const auto& prev = _previous;
+    const auto& cur = _current;
+
+    if (cur[flags] != prev[flags] || cur[button] != prev[button]) {
+        Push(Type::hand, cur[flags], cur[button]);
+    }
+    if (cur[ante] != prev[ante] || cur[small_blind] != prev[small_blind] || cur[big_blind] != prev[big_blind]) {
+        Push(Type::forced_bets, cur[ante], cur[small_blind], cur[big_blind]);
+    }
+    if (cur[round_of_betting] != prev[round_of_betting] && cur[round_of_betting] != -1) {
+        Push(Type::round_of_betting, cur[round_of_betting]);
+    }
+
+    for (std::int32_t i = 0; i < cur[community_cards]; ++i) {
+        const auto card = cur[community_cards + 1 + i];
+        if (i >= prev[community_cards] || card != prev[community_cards + 1 + i]) {
+            Push(Type::card_dealt, i, card);
+        }
+    }
+
+    const auto hand_in_progress_now = (cur[flags] & hand_in_progress) != 0;
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        const auto* p = prev.data() + seats + i * seat_stride;
+        const auto* c = cur.data() + seats + i * seat_stride;
+        const auto seat_index = static_cast<std::int32_t>(i);
+        if (c[seat_flags] & occupied) {
+            if (!(p[seat_flags] & occupied) || c[seat_stack] != p[seat_stack] || c[seat_bet] != p[seat_bet]) {
+                Push(Type::seat, seat_index, c[seat_stack], c[seat_bet]);
+            }
+            if (hand_in_progress_now && (p[seat_flags] & in_hand) && !(c[seat_flags] & in_hand)) {
+                Push(Type::folded, seat_index);
+            }
+        } else if (p[seat_flags] & occupied) {
+            Push(Type::seat_left, seat_index);
+        }
+    }
+
+    const auto num_pots = std::max(cur[pots], prev[pots]);
+    for (std::int32_t i = 0; i < num_pots; ++i) {
+        const auto* p = prev.data() + pots + 1 + i * pot_stride;
+        const auto* c = cur.data() + pots + 1 + i * pot_stride;
+        if (i >= cur[pots]) {
+            Push(Type::pot, i, 0, 0);
+        } else if (i >= prev[pots] || c[0] != p[0] || c[1] != p[1]) {
+            Push(Type::pot, i, c[0], c[1]);
+        }
+    }
+
+    if (cur[player_to_act] != prev[player_to_act]) {
+        Push(Type::player_to_act, cur[player_to_act]);
+    }
+
+    std::swap(_previous, _current);
+}
+
+std::size_t EventLog::Drain(std::int32_t* out, std::size_t max_records) {
+    std::size_t written = 0;
+    if (_overflowed && max_records > 0) {
+        std::fill(out, out + record_size, 0);
+        out[0] = static_cast<std::int32_t>(Type::resync);
+        _overflowed = false;
+        ++written;
+    }
+    for (; written < max_records && _count > 0; ++written) {
+        std::copy_n(_records.data() + _head * record_size, record_size, out + written * record_size);
+        _head = (_head + 1) % _capacity;
+        --_count;
+    }
+    return written;
+}
+
+void EventLog::Push(Type type, std::int32_t a, std::int32_t b, std::int32_t c) {
+    if (_count == _capacity) {
+        _head = (_head + 1) % _capacity;
+        --_count;
+        _overflowed = true;
+    }
+    auto* record = _records.data() + ((_head + _count) % _capacity) * record_size;
+    record[0] = static_cast<std::int32_t>(type);
+    record[1] = a;
+    record[2] = b;
+    record[3] = c;
+    ++_count;
+}
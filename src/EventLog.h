@@ -0,0 +1,53 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Snapshot.h"
+
+// Records what changed at a table as compact delta records in a fixed-capacity ring buffer. Each record is
+// [type, a, b, c]. When the buffer overflows the oldest records are dropped and the next drain starts with a
+// resync record, after which a full snapshot should be taken.
+class EventLog {
+public:
+    static constexpr std::size_t record_size = 4;
+
+    enum class Type : std::int32_t {
+        resync,             // -
+        hand,               // flags (see snapshot::Flags), button
+        round_of_betting,   // round of betting
+        card_dealt,         // position on the board, card
+        seat,               // seat index, stack, bet size
+        seat_left,          // seat index
+        folded,             // seat index
+        pot,                // pot index, size, eligible player bitmask
+        player_to_act,      // seat index
+        forced_bets         // ante, small blind, big blind
+    };
+
+    EventLog(const poker::table& table, std::size_t capacity);
+
+    // Compares the table with the state seen on the previous call and records the differences.
+    void Record(const poker::table& table);
+
+    // Moves up to max_records of the oldest records into out and returns how many were written.
+    std::size_t Drain(std::int32_t* out, std::size_t max_records);
+
+    std::size_t size() const noexcept { return _count + (_overflowed ? 1 : 0); }
+
+private:
+    void Push(Type type, std::int32_t a = 0, std::int32_t b = 0, std::int32_t c = 0);
+
+    std::array<std::int32_t, snapshot::size> _previous;
+    std::array<std::int32_t, snapshot::size> _current;
+    std::vector<std::int32_t> _records;
+    std::size_t _capacity;
+    std::size_t _head = 0;
+    std::size_t _count = 0;
+    bool _overflowed = false;
+};
+
+#endif // EVENT_LOG_H
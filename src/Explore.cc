@@ -0,0 +1,127 @@
+#include "Explore.h"
+
+#include <new>
+#include <stdexcept>
+
+#include "HandHistory.h"
+#include "Snapshot.h"
+
+namespace {
+
+class Explorer {
+public:
+    Explorer(const std::vector<std::uint8_t>& journal, const std::vector<CandidateAction>& candidates,
+             std::size_t max_nodes)
+        : _forced_bets(HandHistoryForcedBets(journal.data(), journal.size()))
+        , _table(_forced_bets)
+        , _candidates(candidates)
+        , _max_nodes(max_nodes)
+    {
+        ReplayHandHistory(journal.data(), journal.size(), _table, &_path);
+    }
+
+    ExploreResult Run(int depth) {
+        Expand(-1, depth);
+        return std::move(_result);
+    }
+
+private:
+    // Rebuilds the scratch table in the state of the node being expanded. A poker::table cannot be copied
+    // safely, so there is no snapshot of the parent to go back to; instead the calls leading to the node are
+    // applied again, decoded once from the journal with the deck already stacked.
+    void Restore() {
+        _table.~table();
+        new (&_table) poker::table{_forced_bets};
+        _path.Apply(_table);
+    }
+
+    // Expects the scratch table in the state of the node, and only rebuilds it once a candidate was applied.
+    void Expand(std::int32_t parent, int depth) {
+        if (!_table.hand_in_progress() || !_table.betting_round_in_progress()) {
+            return;
+        }
+        const auto mark = _path.size();
+        auto modified = false;
+        for (std::size_t i = 0; i < _candidates.size(); ++i) {
+            if (modified) {
+                Restore();
+                modified = false;
+            }
+            const auto decision = Resolve(_candidates[i], _table);
+            if (!decision) {
+                continue;
+            }
+            if (_result.size() == _max_nodes) {
+                throw std::length_error{"Exploration exceeds the maximum number of nodes"};
+            }
+
+            if (decision->action == poker::action::bet || decision->action == poker::action::raise) {
+                _table.action_taken(decision->action, decision->bet_size);
+            } else {
+                _table.action_taken(decision->action);
+            }
+            modified = true;
+
+            const auto node = static_cast<std::int32_t>(_result.size());
+            _result.parents.push_back(parent);
+            _result.actions.push_back(static_cast<std::int32_t>(i));
+            _result.states.resize(_result.states.size() + snapshot::size);
+            WriteSnapshot(_table, _result.states.data() + _result.states.size() - snapshot::size);
+
+            if (depth > 1 && _table.betting_round_in_progress()) {
+                _path.ActionTaken(decision->action, decision->bet_size);
+                Expand(node, depth - 1);
+                _path.Truncate(mark);
+            }
+        }
+    }
+
+    poker::forced_bets _forced_bets;
+    poker::table _table;
+    ReplayScript _path;
+    const std::vector<CandidateAction>& _candidates;
+    std::size_t _max_nodes;
+    ExploreResult _result;
+};
+
+} // namespace
+
+std::optional<Decision> Resolve(const CandidateAction& candidate, const poker::table& table) {
+    using action = poker::action;
+
+    const auto legal = table.legal_actions();
+    const auto can = [&](action a) { return static_cast<bool>(legal.action & a); };
+    const auto aggressive = can(action::bet) ? action::bet : action::raise;
+
+    switch (candidate.kind) {
+    case CandidateAction::Kind::fold:
+        if (can(action::fold)) return Decision{action::fold};
+        break;
+    case CandidateAction::Kind::check:
+        if (can(action::check)) return Decision{action::check};
+        break;
+    case CandidateAction::Kind::call:
+        if (can(action::call)) return Decision{action::call};
+        break;
+    case CandidateAction::Kind::min_raise:
+        if (can(aggressive)) return Decision{aggressive, static_cast<int>(legal.chip_range.min)};
+        break;
+    case CandidateAction::Kind::all_in:
+        if (can(aggressive)) return Decision{aggressive, static_cast<int>(legal.chip_range.max)};
+        break;
+    case CandidateAction::Kind::size:
+        if (can(aggressive) && candidate.size >= legal.chip_range.min && candidate.size <= legal.chip_range.max) {
+            return Decision{aggressive, candidate.size};
+        }
+        break;
+    }
+    return std::nullopt;
+}
+
+ExploreResult Explore(const std::vector<std::uint8_t>& journal, int depth,
+                      const std::vector<CandidateAction>& candidates, std::size_t max_nodes) {
+    if (depth < 1) {
+        return {};
+    }
+    return Explorer{journal, candidates, max_nodes}.Run(depth);
+}
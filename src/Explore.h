@@ -0,0 +1,38 @@
+#ifndef EXPLORE_H
+#define EXPLORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "Policy.h"
+
+// A candidate action tried at every node of an exploration. Kind::size bets or raises to a fixed amount.
+struct CandidateAction {
+    enum class Kind { fold, check, call, min_raise, all_in, size };
+
+    Kind kind = Kind::check;
+    int size = 0;
+};
+
+// Returns the decision a candidate stands for at the current state of table, or nothing if it is not legal.
+std::optional<Decision> Resolve(const CandidateAction& candidate, const poker::table& table);
+
+// The nodes of an explored tree in depth-first order. Node i was reached by applying candidate actions[i] to
+// node parents[i], or to the root if that is -1. states holds a snapshot of every node.
+struct ExploreResult {
+    std::vector<std::int32_t> parents;
+    std::vector<std::int32_t> actions;
+    std::vector<std::int32_t> states;
+
+    std::size_t size() const noexcept { return parents.size(); }
+};
+
+// Applies every legal candidate to the state described by journal (see HandHistory.h), and again to each
+// resulting state up to depth actions deep. Branches stop at the end of the betting round so that cards which
+// have not been dealt yet are never revealed. Throws std::length_error if the tree has more than max_nodes nodes.
+ExploreResult Explore(const std::vector<std::uint8_t>& journal, int depth,
+                      const std::vector<CandidateAction>& candidates, std::size_t max_nodes);
+
+#endif // EXPLORE_H
@@ -0,0 +1,116 @@
+#include "HandEvaluator.h"
+
+#include <array>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+
+// For every 13-bit rank mask, 1 + the rank of the highest card of the best straight in it, or 0.
+std::array<std::uint8_t, 8192> MakeStraightTable() {
+    auto table = std::array<std::uint8_t, 8192>{};
+    for (std::uint32_t mask = 0; mask < 8192; ++mask) {
+        for (std::int32_t top = 12; top >= 4; --top) {
+            const auto straight = std::uint32_t{0x1f} << (top - 4);
+            if ((mask & straight) == straight) {
+                table[mask] = static_cast<std::uint8_t>(top + 1);
+                break;
+            }
+        }
+        // The wheel: A-2-3-4-5.
+        if (table[mask] == 0 && (mask & 0x100f) == 0x100f) {
+            table[mask] = 4;
+        }
+    }
+    return table;
+}
+
+const auto straight_table = MakeStraightTable();
+
+inline std::uint32_t HighestRank(std::uint32_t mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse(&index, mask);
+    return index;
+#else
+    return 31 - __builtin_clz(mask);
+#endif
+}
+
+inline std::uint32_t Popcount(std::uint32_t mask) {
+#ifdef _MSC_VER
+    return __popcnt(mask);
+#else
+    return __builtin_popcount(mask);
+#endif
+}
+
+// Appends the n highest ranks in mask as 4-bit kickers.
+inline std::uint32_t Kickers(std::uint32_t value, std::uint32_t mask, int n) {
+    for (auto i = 0; i < n && mask != 0; ++i) {
+        const auto rank = HighestRank(mask);
+        value = (value << 4) | rank;
+        mask &= ~(1u << rank);
+    }
+    return value;
+}
+
+inline std::uint32_t Make(HandCategory category, std::uint32_t ranks, int num_ranks) {
+    return (static_cast<std::uint32_t>(category) << 20) | (ranks << (4 * (5 - num_ranks)));
+}
+
+} // namespace
+
+std::uint32_t EvaluateHand(CardSet cards) {
+    const auto c = static_cast<std::uint32_t>(cards) & 0x1fff;
+    const auto d = static_cast<std::uint32_t>(cards >> 16) & 0x1fff;
+    const auto h = static_cast<std::uint32_t>(cards >> 32) & 0x1fff;
+    const auto s = static_cast<std::uint32_t>(cards >> 48) & 0x1fff;
+
+    // With at most 7 cards a flush excludes quads and full houses, so it can be decided first.
+    for (const auto suit : {c, d, h, s}) {
+        if (Popcount(suit) >= 5) {
+            if (const auto top = straight_table[suit]) {
+                return Make(HandCategory::straight_flush, top - 1, 1);
+            }
+            return Make(HandCategory::flush, Kickers(0, suit, 5), 5);
+        }
+    }
+
+    const auto ranks = c | d | h | s;
+    const auto quads = c & d & h & s;
+    const auto at_least_3 = (c & d & (h | s)) | (h & s & (c | d));
+    const auto at_least_2 = (c & (d | h | s)) | (d & (h | s)) | (h & s);
+    const auto trips = at_least_3 & ~quads;
+    const auto pairs = at_least_2 & ~at_least_3;
+
+    if (quads) {
+        const auto quad = HighestRank(quads);
+        return Make(HandCategory::four_of_a_kind, Kickers(quad, ranks & ~(1u << quad), 1), 2);
+    }
+    if (trips && (Popcount(trips) >= 2 || pairs)) {
+        const auto trip = HighestRank(trips);
+        const auto pair = HighestRank((trips & ~(1u << trip)) | pairs);
+        return Make(HandCategory::full_house, (trip << 4) | pair, 2);
+    }
+    if (const auto top = straight_table[ranks]) {
+        return Make(HandCategory::straight, top - 1, 1);
+    }
+    if (trips) {
+        const auto trip = HighestRank(trips);
+        return Make(HandCategory::three_of_a_kind, Kickers(trip, ranks & ~trips, 2), 3);
+    }
+    if (Popcount(pairs) >= 2) {
+        const auto high = HighestRank(pairs);
+        const auto low = HighestRank(pairs & ~(1u << high));
+        const auto used = (1u << high) | (1u << low);
+        return Make(HandCategory::two_pair, Kickers((high << 4) | low, ranks & ~used, 1), 3);
+    }
+    if (pairs) {
+        const auto pair = HighestRank(pairs);
+        return Make(HandCategory::pair, Kickers(pair, ranks & ~pairs, 3), 4);
+    }
+    return Make(HandCategory::high_card, Kickers(0, ranks, 5), 5);
+}
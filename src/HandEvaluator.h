@@ -0,0 +1,38 @@
+#ifndef HAND_EVALUATOR_H
+#define HAND_EVALUATOR_H
+
+#include <cstdint>
+
+#include "Card.h"
+
+// A set of cards as a 64-bit mask. Card rank r of suit s is bit s * 16 + r, so each suit occupies its own
+// 16-bit lane and the rank mask of a suit is a plain shift away.
+using CardSet = std::uint64_t;
+
+constexpr CardSet CardBit(std::int32_t card) {
+    return CardSet{1} << (CardSuit(card) * 16 + CardRank(card));
+}
+
+// Hand categories, from weakest to strongest.
+enum class HandCategory : std::int32_t {
+    high_card,
+    pair,
+    two_pair,
+    three_of_a_kind,
+    straight,
+    flush,
+    full_house,
+    four_of_a_kind,
+    straight_flush
+};
+
+// Returns the strength of the best hand of up to 5 cards within cards. Stronger hands compare greater.
+// The category is stored in bits 20 and up, followed by up to five 4-bit ranks deciding ties. Fewer cards
+// are ranked as if the hand was completed with blanks, which is how a hand stands before the river.
+std::uint32_t EvaluateHand(CardSet cards);
+
+constexpr HandCategory HandStrengthCategory(std::uint32_t strength) {
+    return static_cast<HandCategory>(strength >> 20);
+}
+
+#endif // HAND_EVALUATOR_H
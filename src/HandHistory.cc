@@ -0,0 +1,643 @@
+#include "HandHistory.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+#include "Card.h"
+#include "Command.h"
+
+namespace {
+
+class Reader {
+public:
+    Reader(const std::uint8_t* data, std::size_t size) noexcept : _data(data), _size(size) {}
+
+    std::size_t offset() const noexcept { return _offset; }
+    bool done() const noexcept { return _offset == _size; }
+
+    std::uint8_t GetU8() {
+        Require(1);
+        return _data[_offset++];
+    }
+
+    std::uint16_t GetU16() {
+        return Get<std::uint16_t>();
+    }
+
+    std::int32_t GetI32() {
+        return static_cast<std::int32_t>(Get<std::uint32_t>());
+    }
+
+    template<class T>
+    T Get() {
+        Require(sizeof(T));
+        auto value = T{0};
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            value |= static_cast<T>(_data[_offset++]) << (8 * i);
+        }
+        return value;
+    }
+
+    void Skip(std::size_t bytes) {
+        Require(bytes);
+        _offset += bytes;
+    }
+
+private:
+    void Require(std::size_t bytes) const {
+        if (_size - _offset < bytes) {
+            throw std::runtime_error{"Truncated hand history"};
+        }
+    }
+
+    const std::uint8_t* _data;
+    std::size_t _size;
+    std::size_t _offset = 0;
+};
+
+// Hands out a sequence of draws in place of a generator.
+template<class T>
+class DrawEngine {
+public:
+    using result_type = T;
+
+    explicit DrawEngine(const std::vector<std::uint64_t>& draws) noexcept : _draws(draws) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() {
+        if (_next == _draws.size()) {
+            throw std::runtime_error{"Deck needs more draws than there are"};
+        }
+        return static_cast<result_type>(_draws[_next++]);
+    }
+
+    std::size_t remaining() const noexcept { return _draws.size() - _next; }
+
+private:
+    const std::vector<std::uint64_t>& _draws;
+    std::size_t _next = 0;
+};
+
+// The ways the standard libraries implement std::shuffle. All of them swap one element with another for each
+// draw from a uniform_int_distribution: libstdc++ moves the elements from the second one on into the part
+// before them and draws the positions of two elements at once from wide generators, MSVC does the same one
+// element at a time and libc++ picks the element for each position from the part after it.
+enum class ShuffleKind { insertion_pairs, insertion, selection };
+
+// Returns a draw of a 64-bit generator which uniform_int_distribution turns into k out of [0, n), whether it
+// uses the high bits of the draw (libstdc++), its low bits (libc++) or its remainder (MSVC). The draw is in
+// the middle of the k-th of n equal parts of the range and congruent to k modulo both n and the smallest
+// power of two not below it.
+std::uint64_t DrawFor(std::uint64_t k, std::uint64_t n) {
+    const auto part = std::numeric_limits<std::uint64_t>::max() / n;
+    const auto middle = k * part + part / 2;
+    auto power = std::uint64_t{1};
+    while (power < n) {
+        power <<= 1;
+    }
+    const auto period = n / std::gcd(n, power) * power;
+    return middle - (middle - k) % period;
+}
+
+// Returns the draws which make a std::shuffle of the given kind put the unshuffled deck in order.
+std::vector<std::uint64_t> StackDeck(const DeckOrder& order, ShuffleKind kind) {
+    const auto n = order.size();
+    auto draws = std::vector<std::uint64_t>{};
+    if (kind == ShuffleKind::selection) {
+        auto deck = DeckOrder{};
+        std::iota(deck.begin(), deck.end(), std::uint8_t{0});
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            const auto j = static_cast<std::size_t>(std::find(deck.begin() + i, deck.end(), order[i]) - deck.begin());
+            draws.push_back(DrawFor(j - i, n - i));
+            std::swap(deck[i], deck[j]);
+        }
+        return draws;
+    }
+
+    // Undo the swaps from the last one: element i was swapped from position i to the position it has in
+    // the order once the later swaps are undone.
+    auto swaps = std::array<std::uint64_t, std::tuple_size<DeckOrder>::value>{};
+    auto deck = order;
+    for (auto i = n - 1; i > 0; --i) {
+        const auto j = static_cast<std::size_t>(std::find(deck.begin(), deck.begin() + i + 1, i) - deck.begin());
+        swaps[i] = j;
+        std::swap(deck[i], deck[j]);
+    }
+    auto i = std::size_t{1};
+    if (kind == ShuffleKind::insertion_pairs) {
+        if (n % 2 == 0) {
+            draws.push_back(DrawFor(swaps[1], 2));
+            ++i;
+        }
+        for (; i < n; i += 2) {
+            draws.push_back(DrawFor(swaps[i] * (i + 2) + swaps[i + 1], (i + 1) * (i + 2)));
+        }
+    } else {
+        for (; i < n; ++i) {
+            draws.push_back(DrawFor(swaps[i], i + 1));
+        }
+    }
+    return draws;
+}
+
+// Returns the order the deck would be shuffled into by draws, or nothing unless it uses all of them.
+template<class T>
+std::optional<DeckOrder> Shuffle(const std::vector<std::uint64_t>& draws) {
+    auto deck = DeckOrder{};
+    std::iota(deck.begin(), deck.end(), std::uint8_t{0});
+    auto engine = DrawEngine<T>{draws};
+    try {
+        std::shuffle(deck.begin(), deck.end(), engine);
+    } catch (const std::runtime_error&) {
+        return std::nullopt;
+    }
+    if (engine.remaining() != 0) {
+        return std::nullopt;
+    }
+    return deck;
+}
+
+// Finds out how std::shuffle is implemented here by stacking a deck each way.
+ShuffleKind LocalShuffleKind() {
+    static const auto local = [] {
+        auto order = DeckOrder{};
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            order[i] = static_cast<std::uint8_t>((i * 19 + 7) % order.size());
+        }
+        for (const auto kind : { ShuffleKind::insertion_pairs, ShuffleKind::insertion, ShuffleKind::selection }) {
+            if (Shuffle<std::uint64_t>(StackDeck(order, kind)) == order) {
+                return kind;
+            }
+        }
+        throw std::runtime_error{"Cannot stack a deck with this implementation of std::shuffle"};
+    }();
+    return local;
+}
+
+// Deals a hand from its deck order and checks the hole cards against the record. Returns the draws which
+// stacked the deck.
+std::vector<std::uint64_t> DealStackedHand(Reader& reader, poker::table& table, int button) {
+    auto order = DeckOrder{};
+    auto seen = std::bitset<std::tuple_size<DeckOrder>::value>{};
+    for (auto& position : order) {
+        position = reader.GetU8();
+        if (position >= order.size() || seen[position]) {
+            throw std::runtime_error{"Invalid deck order"};
+        }
+        seen.set(position);
+    }
+    auto draws = StackDeck(order, LocalShuffleKind());
+    auto engine = DrawEngine<std::uint64_t>{draws};
+    table.start_hand(engine, button);
+    if (engine.remaining() != 0) {
+        throw std::runtime_error{"Hand used fewer draws than the deck was stacked with"};
+    }
+
+    const auto mask = reader.GetU16();
+    const auto hole_cards = table.hole_cards();
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        const auto dealt = (mask & (1u << i)) != 0;
+        if (dealt != hole_cards.occupancy()[i]
+            || (dealt && (reader.GetU8() != CardIndex(hole_cards[i].first)
+                          || reader.GetU8() != CardIndex(hole_cards[i].second)))) {
+            throw std::runtime_error{"Hole cards differ from the recorded hand"};
+        }
+    }
+    return draws;
+}
+
+Reader ReadHeader(const std::uint8_t* data, std::size_t size) {
+    if (size < history::header_size || std::memcmp(data, history::magic, sizeof(history::magic)) != 0) {
+        throw std::runtime_error{"Not a hand history"};
+    }
+    if (data[sizeof(history::magic)] != history::version) {
+        throw std::runtime_error{"Unsupported hand history version"};
+    }
+    auto reader = Reader{data, size};
+    reader.Skip(history::header_size);
+    return reader;
+}
+
+} // namespace
+
+DeckOrder ShuffledDeck(std::size_t draw_size, const std::vector<std::uint64_t>& draws) {
+    const auto deck = draw_size == 4 ? Shuffle<std::uint32_t>(draws) : Shuffle<std::uint64_t>(draws);
+    if (!deck) {
+        throw std::logic_error{"The table drew more than the shuffle of its deck"};
+    }
+    return *deck;
+}
+
+HandHistoryWriter::HandHistoryWriter(const std::string& path, const poker::table& table)
+    : _file(nullptr)
+{
+    if (table.hand_in_progress()) {
+        throw std::logic_error{"Cannot start recording while a hand is in progress"};
+    }
+    _file = std::fopen(path.c_str(), "wb");
+    if (!_file) {
+        throw std::runtime_error{"Cannot open hand history file: " + path};
+    }
+    _buffer.reserve(buffer_size);
+    Begin(table);
+}
+
+HandHistoryWriter::HandHistoryWriter(const poker::table& table)
+    : _file(nullptr)
+{
+    Reset(table);
+}
+
+HandHistoryWriter::~HandHistoryWriter() {
+    if (_file) {
+        if (!_buffer.empty()) {
+            std::fwrite(_buffer.data(), 1, _buffer.size(), _file);
+        }
+        std::fclose(_file);
+    }
+}
+
+void HandHistoryWriter::Reset(const poker::table& table) {
+    if (table.hand_in_progress()) {
+        throw std::logic_error{"Cannot start recording while a hand is in progress"};
+    }
+    _buffer.clear();
+    _in_hand = false;
+    Begin(table);
+}
+
+void HandHistoryWriter::Restore(const poker::table& table, const std::uint8_t* data, std::size_t size) {
+    _buffer.assign(data, data + size);
+    _in_hand = table.hand_in_progress();
+    _num_community_cards = _in_hand ? table.community_cards().cards().size() : 0;
+}
+
+void HandHistoryWriter::Begin(const poker::table& table) {
+    _buffer.insert(_buffer.end(), std::begin(history::magic), std::end(history::magic));
+    _buffer.push_back(history::version);
+
+    ForcedBets(table.forced_bets());
+    const auto seats = table.seats();
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        if (seats.occupancy()[i]) {
+            SitDown(static_cast<int>(i), seats[i].total_chips());
+        }
+    }
+}
+
+void HandHistoryWriter::ForcedBets(const poker::forced_bets& forced_bets) {
+    Reserve(13);
+    PutU8(static_cast<std::uint8_t>(history::Record::forced_bets));
+    PutI32(forced_bets.ante);
+    PutI32(forced_bets.blinds.small);
+    PutI32(forced_bets.blinds.big);
+}
+
+void HandHistoryWriter::SitDown(int seat, int buy_in) {
+    Reserve(6);
+    PutU8(static_cast<std::uint8_t>(history::Record::sit_down));
+    PutU8(static_cast<std::uint8_t>(seat));
+    PutI32(buy_in);
+}
+
+void HandHistoryWriter::StandUp(int seat) {
+    Reserve(2);
+    PutU8(static_cast<std::uint8_t>(history::Record::stand_up));
+    PutU8(static_cast<std::uint8_t>(seat));
+}
+
+void HandHistoryWriter::StartHand(const poker::table& table, const DeckOrder& deck) {
+    const auto hole_cards = table.hole_cards();
+    auto mask = std::uint16_t{0};
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        if (hole_cards.occupancy()[i]) {
+            mask |= static_cast<std::uint16_t>(1u << i);
+        }
+    }
+    Reserve(4 + deck.size() + 2 * poker::table::num_seats);
+    PutU8(static_cast<std::uint8_t>(history::Record::start_hand));
+    PutU8(static_cast<std::uint8_t>(table.button()));
+    _buffer.insert(_buffer.end(), deck.begin(), deck.end());
+    PutU16(mask);
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        if (hole_cards.occupancy()[i]) {
+            PutU8(static_cast<std::uint8_t>(CardIndex(hole_cards[i].first)));
+            PutU8(static_cast<std::uint8_t>(CardIndex(hole_cards[i].second)));
+        }
+    }
+    _in_hand = true;
+    _num_community_cards = 0;
+}
+
+void HandHistoryWriter::ActionTaken(int seat, poker::action action, int bet) {
+    Reserve(7);
+    PutU8(static_cast<std::uint8_t>(history::Record::action_taken));
+    PutU8(static_cast<std::uint8_t>(seat));
+    PutU8(static_cast<std::uint8_t>(ToActionCode(action)));
+    PutI32(bet);
+}
+
+void HandHistoryWriter::EndBettingRound() {
+    Reserve(1);
+    PutU8(static_cast<std::uint8_t>(history::Record::end_betting_round));
+}
+
+void HandHistoryWriter::Showdown() {
+    Reserve(1);
+    PutU8(static_cast<std::uint8_t>(history::Record::showdown));
+}
+
+void HandHistoryWriter::SetAutomaticAction(int seat, poker::table::automatic_action action) {
+    Reserve(3);
+    PutU8(static_cast<std::uint8_t>(history::Record::set_automatic_action));
+    PutU8(static_cast<std::uint8_t>(seat));
+    PutU8(static_cast<std::uint8_t>(action));
+}
+
+void HandHistoryWriter::CardsDealt(const poker::table& table) {
+    const auto cards = table.community_cards().cards();
+    if (!_in_hand || cards.size() <= _num_community_cards) {
+        return;
+    }
+    Reserve(2 + cards.size() - _num_community_cards);
+    PutU8(static_cast<std::uint8_t>(history::Record::cards_dealt));
+    PutU8(static_cast<std::uint8_t>(cards.size() - _num_community_cards));
+    for (auto i = _num_community_cards; i < cards.size(); ++i) {
+        PutU8(static_cast<std::uint8_t>(CardIndex(cards[i])));
+    }
+    _num_community_cards = cards.size();
+}
+
+void HandHistoryWriter::EndHandIfOver(const poker::table& table) {
+    if (!_in_hand || table.hand_in_progress()) {
+        return;
+    }
+    _in_hand = false;
+
+    const auto seats = table.seats();
+    auto mask = std::uint16_t{0};
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        if (seats.occupancy()[i]) {
+            mask |= static_cast<std::uint16_t>(1u << i);
+        }
+    }
+    Reserve(3 + 4 * poker::table::num_seats);
+    PutU8(static_cast<std::uint8_t>(history::Record::hand_end));
+    PutU16(mask);
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        if (seats.occupancy()[i]) {
+            PutI32(seats[i].total_chips());
+        }
+    }
+}
+
+void HandHistoryWriter::Flush() {
+    if (!_file) {
+        return;
+    }
+    if (!_buffer.empty()) {
+        if (std::fwrite(_buffer.data(), 1, _buffer.size(), _file) != _buffer.size()) {
+            throw std::runtime_error{"Failed to write hand history"};
+        }
+        _buffer.clear();
+    }
+    std::fflush(_file);
+}
+
+void HandHistoryWriter::PutU8(std::uint8_t value) {
+    _buffer.push_back(value);
+}
+
+void HandHistoryWriter::PutU16(std::uint16_t value) {
+    _buffer.push_back(static_cast<std::uint8_t>(value));
+    _buffer.push_back(static_cast<std::uint8_t>(value >> 8));
+}
+
+void HandHistoryWriter::PutI32(std::int32_t value) {
+    const auto bits = static_cast<std::uint32_t>(value);
+    for (auto i = 0; i < 4; ++i) {
+        _buffer.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+    }
+}
+
+// Records are never split across writes, so a history cut short by a crash ends on a record boundary.
+void HandHistoryWriter::Reserve(std::size_t bytes) {
+    if (_file && _buffer.size() + bytes > buffer_size) {
+        Flush();
+    }
+}
+
+poker::forced_bets HandHistoryForcedBets(const std::uint8_t* data, std::size_t size) {
+    auto reader = ReadHeader(data, size);
+    if (reader.done() || reader.GetU8() != static_cast<std::uint8_t>(history::Record::forced_bets)) {
+        throw std::runtime_error{"Hand history does not start with the forced bets"};
+    }
+    const auto ante = reader.GetI32();
+    const auto small_blind = reader.GetI32();
+    const auto big_blind = reader.GetI32();
+    return poker::forced_bets{poker::blinds{small_blind, big_blind}, ante};
+}
+
+void ReplayScript::ForcedBets(const poker::forced_bets& forced_bets) {
+    _steps.push_back({history::Record::forced_bets, forced_bets.ante, forced_bets.blinds.small, forced_bets.blinds.big});
+}
+
+void ReplayScript::SitDown(int seat, int buy_in) {
+    _steps.push_back({history::Record::sit_down, seat, buy_in, 0});
+}
+
+void ReplayScript::StandUp(int seat) {
+    _steps.push_back({history::Record::stand_up, seat, 0, 0});
+}
+
+void ReplayScript::StartHand(int button, std::vector<std::uint64_t> draws) {
+    _steps.push_back({history::Record::start_hand, button, static_cast<std::int32_t>(_draws.size()), 0});
+    _draws.push_back(std::move(draws));
+}
+
+void ReplayScript::ActionTaken(poker::action action, int bet) {
+    _steps.push_back({history::Record::action_taken, static_cast<std::int32_t>(ToActionCode(action)), bet, 0});
+}
+
+void ReplayScript::EndBettingRound() {
+    _steps.push_back({history::Record::end_betting_round, 0, 0, 0});
+}
+
+void ReplayScript::Showdown() {
+    _steps.push_back({history::Record::showdown, 0, 0, 0});
+}
+
+void ReplayScript::SetAutomaticAction(int seat, poker::table::automatic_action action) {
+    _steps.push_back({history::Record::set_automatic_action, seat, static_cast<std::int32_t>(action), 0});
+}
+
+void ReplayScript::Apply(poker::table& table) const {
+    using history::Record;
+
+    for (const auto& step : _steps) {
+        switch (step.record) {
+        case Record::forced_bets:
+            table.set_forced_bets({{step.arg1, step.arg2}, step.arg0});
+            break;
+        case Record::sit_down:
+            table.sit_down(step.arg0, step.arg1);
+            break;
+        case Record::stand_up:
+            table.stand_up(step.arg0);
+            break;
+        case Record::start_hand: {
+            auto engine = DrawEngine<std::uint64_t>{_draws[static_cast<std::size_t>(step.arg1)]};
+            table.start_hand(engine, step.arg0);
+            break;
+        }
+        case Record::action_taken: {
+            const auto action = ToAction(step.arg0);
+            if (action == poker::action::bet || action == poker::action::raise) {
+                table.action_taken(action, step.arg1);
+            } else {
+                table.action_taken(action);
+            }
+            break;
+        }
+        case Record::end_betting_round:
+            table.end_betting_round();
+            break;
+        case Record::showdown:
+            table.showdown();
+            break;
+        case Record::set_automatic_action:
+            table.set_automatic_action(step.arg0, static_cast<poker::table::automatic_action>(step.arg1));
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+ReplayResult ReplayHandHistory(const std::uint8_t* data, std::size_t size, poker::table& table,
+                               ReplayScript* script) {
+    using history::Record;
+
+    auto result = ReplayResult{};
+    auto reader = ReadHeader(data, size);
+    while (!reader.done()) {
+        const auto offset = reader.offset();
+        try {
+            switch (static_cast<Record>(reader.GetU8())) {
+            case Record::forced_bets: {
+                const auto ante = reader.GetI32();
+                const auto small_blind = reader.GetI32();
+                const auto big_blind = reader.GetI32();
+                table.set_forced_bets({{small_blind, big_blind}, ante});
+                if (script) {
+                    script->ForcedBets({{small_blind, big_blind}, ante});
+                }
+                break;
+            }
+            case Record::sit_down: {
+                const auto seat = reader.GetU8();
+                const auto buy_in = reader.GetI32();
+                table.sit_down(seat, buy_in);
+                if (script) {
+                    script->SitDown(seat, buy_in);
+                }
+                break;
+            }
+            case Record::stand_up: {
+                const auto seat = reader.GetU8();
+                table.stand_up(seat);
+                if (script) {
+                    script->StandUp(seat);
+                }
+                break;
+            }
+            case Record::start_hand: {
+                const auto button = reader.GetU8();
+                auto draws = DealStackedHand(reader, table, button);
+                if (script) {
+                    script->StartHand(button, std::move(draws));
+                }
+                ++result.hands;
+                break;
+            }
+            case Record::action_taken: {
+                const auto seat = reader.GetU8();
+                const auto action = ToAction(reader.GetU8());
+                const auto bet = reader.GetI32();
+                if (!table.hand_in_progress() || table.player_to_act() != seat) {
+                    throw std::runtime_error{"Action recorded for a player who is not to act"};
+                }
+                if (action == poker::action::bet || action == poker::action::raise) {
+                    table.action_taken(action, bet);
+                } else {
+                    table.action_taken(action);
+                }
+                if (script) {
+                    script->ActionTaken(action, bet);
+                }
+                ++result.actions;
+                break;
+            }
+            case Record::end_betting_round:
+                table.end_betting_round();
+                if (script) {
+                    script->EndBettingRound();
+                }
+                break;
+            case Record::showdown:
+                table.showdown();
+                if (script) {
+                    script->Showdown();
+                }
+                break;
+            case Record::set_automatic_action: {
+                const auto seat = reader.GetU8();
+                const auto action = static_cast<poker::table::automatic_action>(reader.GetU8());
+                table.set_automatic_action(seat, action);
+                if (script) {
+                    script->SetAutomaticAction(seat, action);
+                }
+                break;
+            }
+            case Record::hand_end: {
+                const auto mask = reader.GetU16();
+                const auto seats = table.seats();
+                for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+                    const auto occupied = (mask & (1u << i)) != 0;
+                    if (occupied != seats.occupancy()[i]
+                        || (occupied && reader.GetI32() != seats[i].total_chips())) {
+                        throw std::runtime_error{"Stacks differ from the recorded hand"};
+                    }
+                }
+                break;
+            }
+            case Record::cards_dealt: {
+                const auto count = reader.GetU8();
+                const auto cards = table.community_cards().cards();
+                if (count > cards.size()) {
+                    throw std::runtime_error{"Community cards differ from the recorded hand"};
+                }
+                for (auto i = cards.size() - count; i < cards.size(); ++i) {
+                    if (reader.GetU8() != CardIndex(cards[i])) {
+                        throw std::runtime_error{"Community cards differ from the recorded hand"};
+                    }
+                }
+                break;
+            }
+            default:
+                throw std::runtime_error{"Invalid record type"};
+            }
+        } catch (const std::exception& e) {
+            throw std::runtime_error{"Hand history record at offset " + std::to_string(offset) + ": " + e.what()};
+        }
+    }
+    return result;
+}
@@ -0,0 +1,196 @@
+#ifndef HAND_HISTORY_H
+#define HAND_HISTORY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+#define POKER_THROW_ON_ERROR
+#include "poker/table.hpp"
+
+// Compact binary log of everything that is done to a table. A history starts with the magic "PKHH" and a
+// version byte, followed by records made of a type byte and a payload. Integers are little-endian and cards
+// are bytes numbered as in Card.h.
+//   forced_bets            i32 ante, i32 small blind, i32 big blind
+//   sit_down               u8 seat, i32 buy-in
+//   stand_up               u8 seat
+//   start_hand             u8 button, u8[52] deck order, u16 mask of the seats dealt in, 2 hole cards of each
+//   action_taken           u8 seat, u8 action code (see Command.h), i32 bet size
+//   end_betting_round      -
+//   showdown               -
+//   set_automatic_action   u8 seat, u8 automatic action
+//   hand_end               u16 occupied seat mask, i32 stack of every occupied seat
+//   cards_dealt            u8 count, community cards dealt by the previous record
+// The deck order of start_hand is the position in the unshuffled deck of every card of the shuffled one, so a
+// replay deals the same cards whichever generator, seed and standard library were used. The hole and
+// community cards make the history readable on its own and, like hand_end, let a replay detect that it
+// diverged.
+//
+// Warning: the table shuffles its own deck, so a replay deals a recorded deck order by feeding the table the
+// draws which make std::shuffle produce it. Working those out (StackDeck, DrawFor and LocalShuffleKind in
+// HandHistory.cc) depends on how std::shuffle and uniform_int_distribution are implemented by libstdc++,
+// libc++ and MSVC. If any of them changes either algorithm, replay throws there until the stacking is updated;
+// recorded histories stay valid, since the deck order does not depend on the implementation.
+namespace history {
+
+constexpr char magic[4] = { 'P', 'K', 'H', 'H' };
+constexpr std::uint8_t version = 1;
+constexpr std::size_t header_size = 5;
+
+enum class Record : std::uint8_t {
+    forced_bets = 1,
+    sit_down,
+    stand_up,
+    start_hand,
+    action_taken,
+    end_betting_round,
+    showdown,
+    set_automatic_action,
+    hand_end,
+    cards_dealt
+};
+
+} // namespace history
+
+// Position in the unshuffled deck of every card of a shuffled deck, from the first card to the last.
+using DeckOrder = std::array<std::uint8_t, 52>;
+
+// Wraps a generator and keeps every value it produces.
+template<class URBG>
+class RecordingEngine {
+public:
+    using result_type = typename URBG::result_type;
+
+    // Number of bytes of a draw: 4 for 32-bit generators and 8 for 64-bit ones.
+    static constexpr std::size_t draw_size = URBG::max() == std::numeric_limits<std::uint32_t>::max() ? 4 : 8;
+
+    static_assert(URBG::min() == 0 && (URBG::max() == std::numeric_limits<std::uint32_t>::max()
+                                       || URBG::max() == std::numeric_limits<std::uint64_t>::max()),
+                  "Only generators producing full 32 or 64-bit values can be recorded");
+
+    RecordingEngine(URBG& engine, std::vector<std::uint64_t>& draws) noexcept
+        : _engine(engine), _draws(draws) {}
+
+    static constexpr result_type min() { return URBG::min(); }
+    static constexpr result_type max() { return URBG::max(); }
+
+    result_type operator()() {
+        const auto value = _engine();
+        _draws.push_back(value);
+        return value;
+    }
+
+private:
+    URBG& _engine;
+    std::vector<std::uint64_t>& _draws;
+};
+
+// Returns the order the deck was shuffled into by the draws of a RecordingEngine. The table shuffles its deck
+// with std::shuffle, so shuffling the positions of the cards with the same draws puts them in the same order.
+DeckOrder ShuffledDeck(std::size_t draw_size, const std::vector<std::uint64_t>& draws);
+
+// Appends the history of a table to a file through a write buffer, or keeps it in memory. The history begins
+// with the forced bets and the players seated when recording starts, so it can only be started between hands.
+class HandHistoryWriter {
+public:
+    HandHistoryWriter(const std::string& path, const poker::table& table);
+    explicit HandHistoryWriter(const poker::table& table);
+    ~HandHistoryWriter();
+
+    HandHistoryWriter(const HandHistoryWriter&) = delete;
+    HandHistoryWriter& operator=(const HandHistoryWriter&) = delete;
+
+    void ForcedBets(const poker::forced_bets& forced_bets);
+    void SitDown(int seat, int buy_in);
+    void StandUp(int seat);
+    void StartHand(const poker::table& table, const DeckOrder& deck);
+    void ActionTaken(int seat, poker::action action, int bet);
+    void EndBettingRound();
+    void Showdown();
+    void SetAutomaticAction(int seat, poker::table::automatic_action action);
+
+    // Writes a cards_dealt record if community cards were dealt since the last one.
+    void CardsDealt(const poker::table& table);
+
+    // Writes a hand_end record if the hand that was started last is over.
+    void EndHandIfOver(const poker::table& table);
+
+    void Flush();
+
+    // Restarts an in-memory history from the current state of table.
+    void Reset(const poker::table& table);
+
+    // Replaces an in-memory history with one that table was replayed from.
+    void Restore(const poker::table& table, const std::uint8_t* data, std::size_t size);
+
+    // The part of the history which has not been flushed yet; all of it for an in-memory history.
+    const std::vector<std::uint8_t>& buffer() const noexcept { return _buffer; }
+
+private:
+    static constexpr std::size_t buffer_size = 64 * 1024;
+
+    void PutU8(std::uint8_t value);
+    void PutU16(std::uint16_t value);
+    void PutI32(std::int32_t value);
+    void Reserve(std::size_t bytes);
+    void Begin(const poker::table& table);
+
+    std::FILE* _file;
+    std::vector<std::uint8_t> _buffer;
+    bool _in_hand = false;
+    std::size_t _num_community_cards = 0;
+};
+
+// The calls a history records, decoded once with the deck of every hand already stacked, so that fresh tables
+// can be driven through the same history again and again without parsing it or stacking decks. The cards and
+// stacks which a history records to detect divergence are checked while decoding and not kept.
+class ReplayScript {
+public:
+    void ForcedBets(const poker::forced_bets& forced_bets);
+    void SitDown(int seat, int buy_in);
+    void StandUp(int seat);
+    void StartHand(int button, std::vector<std::uint64_t> draws);
+    void ActionTaken(poker::action action, int bet);
+    void EndBettingRound();
+    void Showdown();
+    void SetAutomaticAction(int seat, poker::table::automatic_action action);
+
+    // Drives table, constructed with the forced bets of the history, through every call.
+    void Apply(poker::table& table) const;
+
+    std::size_t size() const noexcept { return _steps.size(); }
+
+    // Drops every call after the first size.
+    void Truncate(std::size_t size) { _steps.resize(size); }
+
+private:
+    struct Step {
+        history::Record record;
+        std::int32_t arg0;
+        std::int32_t arg1;
+        std::int32_t arg2;
+    };
+
+    std::vector<Step> _steps;
+    std::vector<std::vector<std::uint64_t>> _draws;
+};
+
+struct ReplayResult {
+    std::uint64_t hands = 0;
+    std::uint64_t actions = 0;
+};
+
+// Returns the forced bets of the first record, which every history starts with.
+poker::forced_bets HandHistoryForcedBets(const std::uint8_t* data, std::size_t size);
+
+// Drives table through every record of a history, and decodes its calls into script if one is given. Throws
+// std::runtime_error with the offset of the offending record when the history is malformed or the table
+// diverges from the recorded hand.
+ReplayResult ReplayHandHistory(const std::uint8_t* data, std::size_t size, poker::table& table,
+                               ReplayScript* script = nullptr);
+
+#endif // HAND_HISTORY_H
@@ -0,0 +1,154 @@
+#include "Metrics.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <exception>
+
+namespace metrics {
+
+const char* const method_names[num_methods] = {
+    "constructor",
+    "seats",
+    "forcedBets",
+    "isHandInProgress",
+    "isBettingRoundInProgress",
+    "areBettingRoundsCompleted",
+    "handPlayers",
+    "button",
+    "playerToAct",
+    "numActivePlayers",
+    "pots",
+    "roundOfBetting",
+    "communityCards",
+    "legalActions",
+    "legalMask",
+    "automaticActions",
+    "canSetAutomaticActions",
+    "legalAutomaticActions",
+    "holeCards",
+    "holeCardSets",
+    "communityCardSet",
+    "snapshot",
+    "setForcedBets",
+    "sitDown",
+    "standUp",
+    "startHand",
+    "actionTaken",
+    "tryAction",
+    "endBettingRound",
+    "showdown",
+    "setAutomaticAction",
+    "enableEvents",
+    "drainEvents",
+    "recordHistory",
+    "flushHistory",
+    "serialize",
+    "fork",
+    "explore",
+    "setPolicy",
+    "advance",
+    "applyBatch",
+    "replay",
+    "deserialize"
+};
+
+namespace {
+
+std::uint64_t Now() noexcept {
+    using namespace std::chrono;
+    return static_cast<std::uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+const auto load_time = Now();
+
+#ifdef POKER_METRICS
+
+// Counters are only ever incremented, so relaxed atomics are enough and recording never blocks.
+struct MethodCounters {
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> failures{0};
+    std::atomic<std::uint64_t> total{0};
+    std::array<std::atomic<std::uint64_t>, num_buckets> buckets{};
+};
+
+std::array<MethodCounters, num_methods> counters;
+std::atomic<std::uint64_t> hands{0};
+
+#endif // POKER_METRICS
+
+} // namespace
+
+std::size_t BucketIndex(std::uint64_t nanoseconds) noexcept {
+    if (nanoseconds < sub_buckets) {
+        return static_cast<std::size_t>(nanoseconds);
+    }
+    auto msb = std::size_t{63};
+    while (!(nanoseconds >> msb)) {
+        --msb;
+    }
+    const auto index = sub_buckets * (msb - 1) + ((nanoseconds >> (msb - 2)) & (sub_buckets - 1));
+    return std::min(index, num_buckets - 1);
+}
+
+std::uint64_t BucketUpperBound(std::size_t index) noexcept {
+    if (index < sub_buckets) {
+        return index;
+    }
+    const auto msb = index / sub_buckets + 1;
+    const auto lower = (sub_buckets + index % sub_buckets) << (msb - 2);
+    return lower + (std::uint64_t{1} << (msb - 2)) - 1;
+}
+
+void Write(double* out) noexcept {
+    std::fill(out, out + size, 0.0);
+    out[version] = 1;
+    out[methods] = num_methods;
+    out[buckets] = num_buckets;
+    out[elapsed] = static_cast<double>(Now() - load_time);
+#ifdef POKER_METRICS
+    out[enabled] = 1;
+    out[hands_started] = static_cast<double>(hands.load(std::memory_order_relaxed));
+    for (std::size_t i = 0; i < num_methods; ++i) {
+        auto* method = out + header_size + i * method_stride;
+        method[0] = static_cast<double>(counters[i].calls.load(std::memory_order_relaxed));
+        method[1] = static_cast<double>(counters[i].failures.load(std::memory_order_relaxed));
+        method[2] = static_cast<double>(counters[i].total.load(std::memory_order_relaxed));
+        for (std::size_t b = 0; b < num_buckets; ++b) {
+            method[3 + b] = static_cast<double>(counters[i].buckets[b].load(std::memory_order_relaxed));
+        }
+    }
+#endif
+}
+
+#ifdef POKER_METRICS
+
+void Record(Method method, std::uint64_t nanoseconds, bool failed) noexcept {
+    auto& c = counters[static_cast<std::size_t>(method)];
+    c.calls.fetch_add(1, std::memory_order_relaxed);
+    if (failed) {
+        c.failures.fetch_add(1, std::memory_order_relaxed);
+    }
+    c.total.fetch_add(nanoseconds, std::memory_order_relaxed);
+    c.buckets[BucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void HandStarted() noexcept {
+    hands.fetch_add(1, std::memory_order_relaxed);
+}
+
+ScopeTimer::ScopeTimer(Method method) noexcept
+    : _method(method)
+    , _exceptions(std::uncaught_exceptions())
+    , _start(Now())
+{
+}
+
+ScopeTimer::~ScopeTimer() {
+    Record(_method, Now() - _start, std::uncaught_exceptions() > _exceptions);
+}
+
+#endif // POKER_METRICS
+
+} // namespace metrics
@@ -0,0 +1,123 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Call counts, failures and latency histograms of the Table methods. Recording is compiled in only when
+// POKER_METRICS is defined (see binding.gyp); otherwise the recording macros expand to nothing and
+// poker.metrics() reports that metrics are disabled.
+namespace metrics {
+
+enum class Method : std::uint32_t {
+    construct,
+    seats,
+    forced_bets,
+    is_hand_in_progress,
+    is_betting_round_in_progress,
+    are_betting_rounds_completed,
+    hand_players,
+    button,
+    player_to_act,
+    num_active_players,
+    pots,
+    round_of_betting,
+    community_cards,
+    legal_actions,
+    legal_mask,
+    automatic_actions,
+    can_set_automatic_actions,
+    legal_automatic_actions,
+    hole_cards,
+    hole_card_sets,
+    community_card_set,
+    snapshot,
+    set_forced_bets,
+    sit_down,
+    stand_up,
+    start_hand,
+    action_taken,
+    try_action,
+    end_betting_round,
+    showdown,
+    set_automatic_action,
+    enable_events,
+    drain_events,
+    record_history,
+    flush_history,
+    serialize,
+    fork,
+    explore,
+    set_policy,
+    advance,
+    apply_batch,
+    replay,
+    deserialize,
+    count
+};
+
+constexpr std::size_t num_methods = static_cast<std::size_t>(Method::count);
+
+// JS names of the methods, indexed by Method.
+extern const char* const method_names[num_methods];
+
+// Latencies are kept in log-linear buckets in nanoseconds: values below 4 have a bucket each, and every
+// power of two above is split into 4 buckets. The last bucket also holds everything larger.
+constexpr std::size_t sub_buckets = 4;
+constexpr std::size_t num_buckets = 128;
+
+std::size_t BucketIndex(std::uint64_t nanoseconds) noexcept;
+
+// Largest value which falls into a bucket.
+std::uint64_t BucketUpperBound(std::size_t index) noexcept;
+
+// Layout of the flat array written by Write.
+enum Header : std::size_t {
+    version,            // layout version (1)
+    enabled,            // 1 if the addon was built with POKER_METRICS
+    methods,            // number of methods
+    buckets,            // number of histogram buckets per method
+    elapsed,            // nanoseconds since the addon was loaded
+    hands_started,      // number of hands started
+    header_size
+};
+
+// Each method has calls, failures (calls which threw), total latency in nanoseconds and the histogram.
+constexpr std::size_t method_stride = 3 + num_buckets;
+constexpr std::size_t size = header_size + num_methods * method_stride;
+
+void Write(double* out) noexcept;
+
+#ifdef POKER_METRICS
+
+void Record(Method method, std::uint64_t nanoseconds, bool failed) noexcept;
+void HandStarted() noexcept;
+
+// Records the latency of a scope on exit, counting it as failed if it is left by an exception.
+class ScopeTimer {
+public:
+    explicit ScopeTimer(Method method) noexcept;
+    ~ScopeTimer();
+
+    ScopeTimer(const ScopeTimer&) = delete;
+    ScopeTimer& operator=(const ScopeTimer&) = delete;
+
+private:
+    Method _method;
+    int _exceptions;
+    std::uint64_t _start;
+};
+
+#define POKER_METRICS_SCOPE(method) ::metrics::ScopeTimer poker_metrics_scope{::metrics::Method::method}
+#define POKER_METRICS_HAND_STARTED() ::metrics::HandStarted()
+
+#else
+
+#define POKER_METRICS_SCOPE(method) static_cast<void>(0)
+#define POKER_METRICS_HAND_STARTED() static_cast<void>(0)
+
+#endif // POKER_METRICS
+
+} // namespace metrics
+
+#endif // METRICS_H
@@ -0,0 +1,163 @@
+#ifndef POLICY_H
+#define POLICY_H
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#define POKER_THROW_ON_ERROR
+#include "poker/table.hpp"
+
+#include "Card.h"
+#include "Equity.h"
+#include "PreflopEquity.h"
+
+// A single decision made for the player to act.
+struct Decision {
+    poker::action action = poker::action::check;
+    int bet_size = 0;
+};
+
+// A built-in native strategy used to drive a seat without calling back into JS.
+struct Policy {
+    enum class Kind { check_call, fold_to_raise, mix, equity_threshold, range };
+
+    Kind kind = Kind::check_call;
+
+    // Relative weights used by Kind::mix. Aggressive actions use the minimum legal bet size.
+    double fold_weight = 0.0;
+    double passive_weight = 1.0;
+    double aggressive_weight = 0.0;
+
+    // Kind::equity_threshold compares the equity against random hands of the other active players, estimated
+    // from equity_iterations samples, with the equity needed to call and to make a minimum bet or raise.
+    double call_equity = 0.0;
+    double raise_equity = 1.0;
+    std::uint32_t equity_iterations = 500;
+
+    // Kind::range raises with the hand classes of raise_range and calls with those of call_range before the
+    // flop, and folds the rest. After the flop it checks or calls with either range and check-folds otherwise.
+    std::bitset<num_hand_classes> raise_range;
+    std::bitset<num_hand_classes> call_range;
+};
+
+// Returns the largest bet placed in the current round of betting.
+inline int MaxBetSize(const poker::table& table) {
+    auto seats = table.seats();
+    auto max_bet = 0;
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        if (seats.occupancy()[i]) {
+            max_bet = std::max(max_bet, static_cast<int>(seats[i].bet_size()));
+        }
+    }
+    return max_bet;
+}
+
+// Decides the action of the player to act. Precondition: a betting round is in progress.
+template<class URBG>
+Decision Decide(const Policy& policy, const poker::table& table, URBG& rng) {
+    using action = poker::action;
+
+    const auto legal = table.legal_actions();
+    const auto can = [&](action a) { return static_cast<bool>(legal.action & a); };
+    const auto passive = can(action::check) ? action::check : action::call;
+    const auto fold_or_check = Decision{passive == action::check ? action::check : action::fold};
+    const auto aggressive = [&]() -> Decision {
+        if (can(action::bet)) {
+            return {action::bet, static_cast<int>(legal.chip_range.min)};
+        }
+        if (can(action::raise)) {
+            return {action::raise, static_cast<int>(legal.chip_range.min)};
+        }
+        return {passive};
+    };
+    const auto hole_cards = [&] {
+        const auto& hc = table.hole_cards()[table.player_to_act()];
+        return std::array<std::int32_t, 2>{CardIndex(hc.first), CardIndex(hc.second)};
+    };
+
+    switch (policy.kind) {
+    case Policy::Kind::check_call:
+        return {passive};
+    case Policy::Kind::fold_to_raise:
+        if (passive == action::check) {
+            return {action::check};
+        }
+        if (table.round_of_betting() == poker::round_of_betting::preflop
+            && MaxBetSize(table) <= table.forced_bets().blinds.big) {
+            return {action::call};
+        }
+        return {action::fold};
+    case Policy::Kind::mix: {
+        const auto total = policy.fold_weight + policy.passive_weight + policy.aggressive_weight;
+        const auto r = std::uniform_real_distribution<double>{0.0, total}(rng);
+        if (r < policy.fold_weight) {
+            // Never fold when checking is free.
+            return fold_or_check;
+        }
+        if (r < policy.fold_weight + policy.passive_weight) {
+            return {passive};
+        }
+        return aggressive();
+    }
+    case Policy::Kind::equity_threshold: {
+        auto board = std::vector<std::int32_t>{};
+        for (const auto& card : table.community_cards().cards()) {
+            board.push_back(CardIndex(card));
+        }
+        const auto num_opponents = static_cast<std::size_t>(std::max(1, table.num_active_players() - 1));
+        const auto equity = EstimateEquityVsRandom(hole_cards(), board, num_opponents, policy.equity_iterations,
+                                                   std::uniform_int_distribution<std::uint64_t>{}(rng));
+        if (equity >= policy.raise_equity) {
+            return aggressive();
+        }
+        if (equity >= policy.call_equity) {
+            return {passive};
+        }
+        return fold_or_check;
+    }
+    case Policy::Kind::range: {
+        const auto cards = hole_cards();
+        const auto hand_class = HandClass(cards[0], cards[1]);
+        const auto raises = policy.raise_range.test(static_cast<std::size_t>(hand_class));
+        const auto calls = policy.call_range.test(static_cast<std::size_t>(hand_class));
+        if (table.round_of_betting() == poker::round_of_betting::preflop && raises) {
+            return aggressive();
+        }
+        if (raises || calls) {
+            return {passive};
+        }
+        return fold_or_check;
+    }
+    default:
+        throw std::invalid_argument{"Internal error: invalid Policy::Kind"};
+    }
+}
+
+// Plays the hand in progress to its end, taking the decision of each seat with policy_of(seat). Returns
+// whether the hand went to a showdown between several players.
+template<class PolicyOf, class URBG>
+bool PlayHand(poker::table& table, PolicyOf&& policy_of, URBG& rng) {
+    auto showdown = false;
+    while (table.hand_in_progress()) {
+        while (table.betting_round_in_progress()) {
+            const auto decision = Decide(policy_of(table.player_to_act()), table, rng);
+            if (decision.action == poker::action::bet || decision.action == poker::action::raise) {
+                table.action_taken(decision.action, decision.bet_size);
+            } else {
+                table.action_taken(decision.action);
+            }
+        }
+        table.end_betting_round();
+        if (table.betting_rounds_completed()) {
+            showdown = table.num_active_players() > 1;
+            table.showdown();
+        }
+    }
+    return showdown;
+}
+
+#endif // POLICY_H
@@ -0,0 +1,185 @@
+#include "PreflopEquity.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Card.h"
+
+namespace {
+
+constexpr char rank_chars[] = "23456789TJQKA";
+constexpr char magic[] = { 'P', 'F', 'E', 'Q' };
+
+std::int32_t ParseRankChar(char c) {
+    for (std::int32_t i = 0; i < 13; ++i) {
+        if (rank_chars[i] == c) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool IsValidHeader(const unsigned char* data) {
+    const auto read_u32 = [&](std::size_t offset) {
+        return static_cast<std::uint32_t>(data[offset]) | (static_cast<std::uint32_t>(data[offset + 1]) << 8)
+            | (static_cast<std::uint32_t>(data[offset + 2]) << 16) | (static_cast<std::uint32_t>(data[offset + 3]) << 24);
+    };
+    return std::memcmp(data, magic, sizeof(magic)) == 0 && read_u32(4) == PreflopEquityTable::version
+        && read_u32(8) == num_hand_classes && read_u32(12) == PreflopEquityTable::num_columns;
+}
+
+} // namespace
+
+std::int32_t HandClass(std::int32_t first, std::int32_t second) {
+    const auto hi = std::max(CardRank(first), CardRank(second));
+    const auto lo = std::min(CardRank(first), CardRank(second));
+    if (hi == lo || CardSuit(first) == CardSuit(second)) {
+        return hi * 13 + lo;
+    }
+    return lo * 13 + hi;
+}
+
+std::int32_t ParseHandClass(std::string_view name) {
+    if (name.size() < 2 || name.size() > 3) {
+        return -1;
+    }
+    const auto hi = ParseRankChar(name[0]);
+    const auto lo = ParseRankChar(name[1]);
+    if (hi == -1 || lo == -1 || hi < lo) {
+        return -1;
+    }
+    if (hi == lo) {
+        return name.size() == 2 ? hi * 13 + lo : -1;
+    }
+    if (name.size() != 3 || (name[2] != 's' && name[2] != 'o')) {
+        return -1;
+    }
+    return name[2] == 's' ? hi * 13 + lo : lo * 13 + hi;
+}
+
+std::string HandClassName(std::int32_t hand_class) {
+    const auto row = hand_class / 13;
+    const auto column = hand_class % 13;
+    auto name = std::string{rank_chars[std::max(row, column)], rank_chars[std::min(row, column)]};
+    if (row > column) {
+        name += 's';
+    } else if (row < column) {
+        name += 'o';
+    }
+    return name;
+}
+
+std::vector<std::array<std::int32_t, 2>> HandClassCombos(std::int32_t hand_class) {
+    const auto row = hand_class / 13;
+    const auto column = hand_class % 13;
+    const auto hi = std::max(row, column);
+    const auto lo = std::min(row, column);
+    auto combos = std::vector<std::array<std::int32_t, 2>>{};
+    for (std::int32_t s1 = 0; s1 < 4; ++s1) {
+        for (std::int32_t s2 = 0; s2 < 4; ++s2) {
+            const auto suited = s1 == s2;
+            if ((row == column && s1 < s2) || (row > column && suited) || (row < column && !suited)) {
+                combos.push_back({hi * 4 + s1, lo * 4 + s2});
+            }
+        }
+    }
+    return combos;
+}
+
+PreflopEquityTable::PreflopEquityTable(const std::string& path) {
+#ifdef _WIN32
+    _file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (_file == INVALID_HANDLE_VALUE) {
+        _file = nullptr;
+        throw std::runtime_error{"Cannot open preflop equity table: " + path};
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(_file, &size) || static_cast<std::size_t>(size.QuadPart) != file_size) {
+        CloseHandle(_file);
+        throw std::runtime_error{"Invalid preflop equity table: " + path};
+    }
+    _mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    _data = _mapping ? static_cast<const unsigned char*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+    if (!_data) {
+        if (_mapping) CloseHandle(_mapping);
+        CloseHandle(_file);
+        throw std::runtime_error{"Cannot map preflop equity table: " + path};
+    }
+#else
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw std::runtime_error{"Cannot open preflop equity table: " + path};
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) != file_size) {
+        ::close(fd);
+        throw std::runtime_error{"Invalid preflop equity table: " + path};
+    }
+    auto* data = ::mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        throw std::runtime_error{"Cannot map preflop equity table: " + path};
+    }
+    _data = static_cast<const unsigned char*>(data);
+#endif
+    if (!IsValidHeader(_data)) {
+        Unmap();
+        throw std::runtime_error{"Invalid preflop equity table: " + path};
+    }
+}
+
+PreflopEquityTable::~PreflopEquityTable() {
+    Unmap();
+}
+
+void PreflopEquityTable::Unmap() noexcept {
+#ifdef _WIN32
+    if (_data) UnmapViewOfFile(_data);
+    if (_mapping) CloseHandle(_mapping);
+    if (_file) CloseHandle(_file);
+    _mapping = nullptr;
+    _file = nullptr;
+#else
+    if (_data) ::munmap(const_cast<unsigned char*>(_data), file_size);
+#endif
+    _data = nullptr;
+}
+
+void PreflopEquityTable::Write(const std::string& path, const std::vector<double>& equities) {
+    if (equities.size() != num_hand_classes * num_columns) {
+        throw std::invalid_argument{"Expected an equity for every entry of the table"};
+    }
+    auto bytes = std::vector<unsigned char>(file_size);
+    const auto write_u32 = [&](std::size_t offset, std::uint32_t value) {
+        for (auto i = 0; i < 4; ++i) {
+            bytes[offset + i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+    };
+    std::memcpy(bytes.data(), magic, sizeof(magic));
+    write_u32(4, version);
+    write_u32(8, num_hand_classes);
+    write_u32(12, num_columns);
+    for (std::size_t i = 0; i < equities.size(); ++i) {
+        const auto value = static_cast<std::uint16_t>(std::lround(std::min(1.0, std::max(0.0, equities[i])) * 65535.0));
+        bytes[header_size + 2 * i] = static_cast<unsigned char>(value);
+        bytes[header_size + 2 * i + 1] = static_cast<unsigned char>(value >> 8);
+    }
+    auto file = std::ofstream{path, std::ios::binary};
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+        throw std::runtime_error{"Cannot write preflop equity table: " + path};
+    }
+}
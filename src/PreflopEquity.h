@@ -0,0 +1,72 @@
+#ifndef PREFLOP_EQUITY_H
+#define PREFLOP_EQUITY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Starting hands are grouped into 169 classes. With ranks hi >= lo, a pair is hi * 13 + hi, a suited hand is
+// hi * 13 + lo and an offsuit hand is lo * 13 + hi.
+constexpr std::int32_t num_hand_classes = 169;
+
+std::int32_t HandClass(std::int32_t first, std::int32_t second);
+
+// Parses class names such as "AA", "AKs" and "T9o". Returns -1 if the name is invalid.
+std::int32_t ParseHandClass(std::string_view name);
+
+std::string HandClassName(std::int32_t hand_class);
+
+// Returns every concrete combination of two cards in a hand class.
+std::vector<std::array<std::int32_t, 2>> HandClassCombos(std::int32_t hand_class);
+
+// A precomputed table of heads-up preflop equities, memory-mapped from a file so that processes share its
+// pages. Row a holds the equity of class a against each class b, followed by its equity against a random
+// hand. The file format is:
+//   char[4]   magic "PFEQ"
+//   uint32    version (1)
+//   uint32    number of rows (169)
+//   uint32    number of columns (170)
+//   uint16[]  rows * columns equities scaled to 0..65535, little-endian
+class PreflopEquityTable {
+public:
+    static constexpr std::uint32_t version = 1;
+    static constexpr std::size_t num_columns = num_hand_classes + 1;
+    static constexpr std::size_t header_size = 16;
+    static constexpr std::size_t file_size = header_size + num_hand_classes * num_columns * sizeof(std::uint16_t);
+
+    explicit PreflopEquityTable(const std::string& path);
+    ~PreflopEquityTable();
+
+    PreflopEquityTable(const PreflopEquityTable&) = delete;
+    PreflopEquityTable& operator=(const PreflopEquityTable&) = delete;
+
+    double Equity(std::int32_t hand_class, std::int32_t opponent_class) const noexcept {
+        return Entry(hand_class, static_cast<std::size_t>(opponent_class));
+    }
+
+    double EquityVsRandom(std::int32_t hand_class) const noexcept {
+        return Entry(hand_class, num_hand_classes);
+    }
+
+    // Writes a table in the format above.
+    static void Write(const std::string& path, const std::vector<double>& equities);
+
+private:
+    void Unmap() noexcept;
+
+    double Entry(std::int32_t row, std::size_t column) const noexcept {
+        const auto* entry = _data + header_size + (row * num_columns + column) * sizeof(std::uint16_t);
+        return static_cast<double>(entry[0] | (entry[1] << 8)) / 65535.0;
+    }
+
+    const unsigned char* _data = nullptr;
+#ifdef _WIN32
+    void* _file = nullptr;
+    void* _mapping = nullptr;
+#endif
+};
+
+#endif // PREFLOP_EQUITY_H
@@ -0,0 +1,55 @@
+#include "PreflopEquityLookup.h"
+
+#include "AddonData.h"
+#include "Conversions.h"
+
+namespace {
+
+std::int32_t ToHandClass(Napi::Env env, Napi::Value value) {
+    if (value.IsString()) {
+        char buffer[16];
+        const auto hand_class = ParseHandClass(ToStringView(value, buffer));
+        if (hand_class != -1) {
+            return hand_class;
+        }
+    }
+    const auto hole_cards = ToHoleCards(env, value);
+    return HandClass(hole_cards[0], hole_cards[1]);
+}
+
+} // namespace
+
+Napi::Object PreflopEquityLookup::Init(Napi::Env env, Napi::Object exports) {
+    exports.Set("loadPreflopEquityTable", Napi::Function::New(env, &PreflopEquityLookup::Load, "loadPreflopEquityTable"));
+    exports.Set("preflopEquity", Napi::Function::New(env, &PreflopEquityLookup::Lookup, "preflopEquity"));
+    return exports;
+}
+
+Napi::Value PreflopEquityLookup::Load(const Napi::CallbackInfo& info) try {
+    if (info.Length() != 1 || !info[0].IsString()) {
+        throw Napi::TypeError::New(info.Env(), "Expected 1 argument of type String");
+    }
+    GetAddonData(info.Env()).preflop_equity_table = std::make_unique<PreflopEquityTable>(info[0].As<Napi::String>().Utf8Value());
+    return info.Env().Undefined();
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value PreflopEquityLookup::Lookup(const Napi::CallbackInfo& info) try {
+    auto env = info.Env();
+    const auto& table = GetAddonData(env).preflop_equity_table;
+    if (!table) {
+        throw Napi::Error::New(env, "Preflop equity table is not loaded");
+    }
+    if (info.Length() < 1) {
+        throw Napi::TypeError::New(env, "Expected at least 1 argument");
+    }
+    const auto hand_class = ToHandClass(env, info[0]);
+    char buffer[16];
+    if (info.Length() < 2 || info[1].IsUndefined() || (info[1].IsString() && ToStringView(info[1], buffer) == "random")) {
+        return Napi::Number::New(env, table->EquityVsRandom(hand_class));
+    }
+    return Napi::Number::New(env, table->Equity(hand_class, ToHandClass(env, info[1])));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
@@ -0,0 +1,16 @@
+#ifndef PREFLOP_EQUITY_LOOKUP_H
+#define PREFLOP_EQUITY_LOOKUP_H
+
+#include <napi.h>
+
+// Exposes the memory-mapped preflop equity table. Lookups are O(1) and allocate nothing.
+class PreflopEquityLookup {
+public:
+    static Napi::Object Init(Napi::Env env, Napi::Object exports);
+
+private:
+    static Napi::Value Load(const Napi::CallbackInfo& info);
+    static Napi::Value Lookup(const Napi::CallbackInfo& info);
+};
+
+#endif // PREFLOP_EQUITY_LOOKUP_H
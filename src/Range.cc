@@ -0,0 +1,198 @@
+#include "Range.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+#include "Card.h"
+#include "PreflopEquity.h"
+
+namespace {
+
+constexpr char rank_chars[] = "23456789TJQKA";
+constexpr char suit_chars[] = "cdhs";
+
+std::int32_t ParseChar(const char* chars, std::size_t count, char c) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (chars[i] == c) {
+            return static_cast<std::int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+std::int32_t ParseRank(char c) { return ParseChar(rank_chars, 13, c); }
+std::int32_t ParseSuit(char c) { return ParseChar(suit_chars, 4, c); }
+
+// Hand classes from the strongest (AA, with 85.2% equity) to the weakest (32o, with 32.3%) by their exact
+// equity against a random hand, found by enumerating every board and opponent hand for each class.
+constexpr std::int32_t hand_class_order[num_hand_classes] = {
+    168, 154, 140, 126, 112,  98,  84, 167,  70, 166, 165, 155, 164,
+    142, 129, 153,  56, 163, 116, 152, 162, 151, 141, 161, 103, 128,
+     42, 139, 150, 159, 160,  90, 115, 138, 158,  77, 149, 157, 127,
+    102,  51,  64, 137, 148, 125, 156, 114,  28,  38, 147,  89, 136,
+     25, 146, 124, 101, 113,  76,  12, 145, 135,  63, 144, 111, 123,
+     14, 134,  88,  50, 100, 143, 133, 110,  37, 122, 132,  75,  99,
+     87,  24,  62, 131,  97, 109, 121,  11,   0, 130,  49, 120,  86,
+     74,  36,  96, 119, 108, 118,  23,  85,  83,  73,  61,  95, 117,
+     10, 107,  48, 106,  72,  82,  35,  60,  94, 105,  69,  22,  71,
+    104,  81,  59,   9,  47,  93,  68,  34,  92,  58,  55,  80,  46,
+     21,  91,  57,  67,   8,  41,  45,  54,  79,  33,  44,  78,  66,
+     20,  43,  40,  53,  32,   7,  27,  31,  65,  29,  30,  39,  52,
+     19,  26,   6,  18,  16,  17,  13,  15,   5,   3,   4,   2,   1,
+};
+
+class RangeBuilder {
+public:
+    void AddClass(std::int32_t hand_class) {
+        for (const auto& combo : HandClassCombos(hand_class)) {
+            Add(combo[0], combo[1]);
+        }
+    }
+
+    // Adds the pairs, suited or offsuit hands (or both when suited is empty) of ranks [hi, lo] for every lo
+    // in [lo_begin, lo_end].
+    void AddClasses(std::int32_t hi, std::int32_t lo_begin, std::int32_t lo_end, char suited) {
+        for (auto lo = lo_begin; lo <= lo_end; ++lo) {
+            if (hi == lo) {
+                AddClass(hi * 13 + hi);
+                continue;
+            }
+            if (suited != 'o') {
+                AddClass(hi * 13 + lo);
+            }
+            if (suited != 's') {
+                AddClass(lo * 13 + hi);
+            }
+        }
+    }
+
+    void Add(std::int32_t first, std::int32_t second) {
+        const auto hi = std::max(first, second);
+        const auto lo = std::min(first, second);
+        if (!_seen.test(static_cast<std::size_t>(hi * num_cards + lo))) {
+            _seen.set(static_cast<std::size_t>(hi * num_cards + lo));
+            _combos.push_back({hi, lo});
+        }
+    }
+
+    std::vector<Combo> Build() {
+        std::sort(_combos.begin(), _combos.end());
+        return std::move(_combos);
+    }
+
+private:
+    std::bitset<num_cards * num_cards> _seen;
+    std::vector<Combo> _combos;
+};
+
+struct ClassName {
+    std::int32_t hi;
+    std::int32_t lo;
+    char suited; // 's', 'o' or 0 for both
+};
+
+bool ParseClassName(const std::string& name, ClassName& result) {
+    if (name.size() < 2 || name.size() > 3) {
+        return false;
+    }
+    result.hi = ParseRank(name[0]);
+    result.lo = ParseRank(name[1]);
+    result.suited = name.size() == 3 ? name[2] : 0;
+    if (result.hi == -1 || result.lo == -1 || result.hi < result.lo) {
+        return false;
+    }
+    if (result.hi == result.lo) {
+        return result.suited == 0;
+    }
+    return result.suited == 0 || result.suited == 's' || result.suited == 'o';
+}
+
+void AddPart(RangeBuilder& builder, const std::string& part) {
+    const auto invalid = [&] { return std::invalid_argument{"Invalid range: " + part}; };
+
+    if (part.back() == '%') {
+        auto percent = 0.0;
+        auto stream = std::istringstream{part.substr(0, part.size() - 1)};
+        if (!(stream >> percent) || !stream.eof() || percent < 0.0 || percent > 100.0) {
+            throw invalid();
+        }
+        // Take whole classes until the range holds the closest number of combinations to the percentage.
+        const auto target = percent / 100.0 * 1326.0;
+        auto total = 0.0;
+        for (const auto hand_class : hand_class_order) {
+            const auto size = static_cast<double>(HandClassCombos(hand_class).size());
+            if (std::abs(total + size - target) > std::abs(total - target)) {
+                break;
+            }
+            builder.AddClass(hand_class);
+            total += size;
+        }
+        return;
+    }
+
+    if (part.size() == 4 && ParseSuit(part[1]) != -1 && ParseSuit(part[3]) != -1) {
+        const auto r1 = ParseRank(part[0]);
+        const auto r2 = ParseRank(part[2]);
+        const auto first = r1 * 4 + ParseSuit(part[1]);
+        const auto second = r2 * 4 + ParseSuit(part[3]);
+        if (r1 == -1 || r2 == -1 || first == second) {
+            throw invalid();
+        }
+        builder.Add(first, second);
+        return;
+    }
+
+    const auto dash = part.find('-');
+    if (dash != std::string::npos) {
+        auto from = ClassName{};
+        auto to = ClassName{};
+        if (!ParseClassName(part.substr(0, dash), from) || !ParseClassName(part.substr(dash + 1), to)
+            || from.suited != to.suited) {
+            throw invalid();
+        }
+        if (from.hi == from.lo && to.hi == to.lo) {
+            for (auto rank = std::min(from.hi, to.hi); rank <= std::max(from.hi, to.hi); ++rank) {
+                builder.AddClass(rank * 13 + rank);
+            }
+        } else if (from.hi == to.hi && from.hi != from.lo && to.hi != to.lo) {
+            builder.AddClasses(from.hi, std::min(from.lo, to.lo), std::max(from.lo, to.lo), from.suited);
+        } else {
+            throw invalid();
+        }
+        return;
+    }
+
+    const auto plus = part.back() == '+';
+    auto name = ClassName{};
+    if (!ParseClassName(plus ? part.substr(0, part.size() - 1) : part, name)) {
+        throw invalid();
+    }
+    if (!plus) {
+        builder.AddClasses(name.hi, name.lo, name.lo, name.suited);
+    } else if (name.hi == name.lo) {
+        for (auto rank = name.hi; rank < 13; ++rank) {
+            builder.AddClass(rank * 13 + rank);
+        }
+    } else {
+        builder.AddClasses(name.hi, name.lo, name.hi - 1, name.suited);
+    }
+}
+
+} // namespace
+
+std::vector<Combo> ParseRange(const std::string& range) {
+    auto builder = RangeBuilder{};
+    auto stream = std::istringstream{range};
+    for (std::string part; std::getline(stream, part, ',');) {
+        part.erase(std::remove_if(part.begin(), part.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); }),
+                   part.end());
+        if (!part.empty()) {
+            AddPart(builder, part);
+        }
+    }
+    return builder.Build();
+}
@@ -0,0 +1,20 @@
+#ifndef RANGE_H
+#define RANGE_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A range of starting hands as the distinct two-card combinations it holds, each as [higher card, lower card]
+// in increasing order.
+using Combo = std::array<std::int32_t, 2>;
+
+// Parses standard range notation: comma-separated hand classes ("AA", "AKs", "KQo", "AK" for both), each
+// optionally followed by "+" to include every stronger kicker ("A2s+", "KTo+") or every higher pair ("22+"),
+// spans such as "A2s-A5s" and "99-QQ", single combinations such as "AhKh", and percentages such as "15%" for
+// the strongest starting hands by equity against a random hand. Throws std::invalid_argument when a part of
+// the range is invalid.
+std::vector<Combo> ParseRange(const std::string& range);
+
+#endif // RANGE_H
@@ -0,0 +1,296 @@
+#include "RangeEquity.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+#include "Rng.h"
+
+namespace {
+
+struct Tally {
+    std::uint64_t wins[2] = {};
+    std::uint64_t ties = 0;
+    std::uint64_t matchups = 0;
+    std::uint64_t hands[2] = {};
+    std::uint64_t categories[2][num_hand_categories] = {};
+    std::uint64_t boards = 0;
+
+    Tally& operator+=(const Tally& other) {
+        for (std::size_t r = 0; r < 2; ++r) {
+            wins[r] += other.wins[r];
+            hands[r] += other.hands[r];
+            for (std::size_t c = 0; c < num_hand_categories; ++c) {
+                categories[r][c] += other.categories[r][c];
+            }
+        }
+        ties += other.ties;
+        matchups += other.matchups;
+        boards += other.boards;
+        return *this;
+    }
+};
+
+// Evaluates the hands of both ranges on board and compares every pair of combinations which can be dealt
+// together. A strength of 0 marks a combination holding a card of the board.
+class Matchups {
+public:
+    Matchups(const std::vector<CardSet>& range1, const std::vector<CardSet>& range2)
+        : _ranges{&range1, &range2}, _strengths{std::vector<std::uint32_t>(range1.size()), std::vector<std::uint32_t>(range2.size())}
+    {
+        for (std::size_t r = 0; r < 2; ++r) {
+            for (const auto hand : *_ranges[r]) {
+                _low_bits[r].push_back(LowBit(hand));
+                _high_bits[r].push_back(LowBit(hand & (hand - 1)));
+            }
+        }
+    }
+
+    void operator()(CardSet board, Tally& tally) {
+        for (std::size_t r = 0; r < 2; ++r) {
+            const auto& range = *_ranges[r];
+            auto& strengths = _strengths[r];
+            for (std::size_t i = 0; i < range.size(); ++i) {
+                if (range[i] & board) {
+                    strengths[i] = 0;
+                    continue;
+                }
+                strengths[i] = EvaluateHand(range[i] | board);
+                ++tally.hands[r];
+                ++tally.categories[r][static_cast<std::size_t>(HandStrengthCategory(strengths[i]))];
+            }
+        }
+
+        // The inner loop only uses 32-bit lanes and no branches, so that the compiler vectorizes it. Cards are
+        // compared by their bit index, as comparing 64-bit card sets needs instructions beyond SSE2.
+        const auto num_combos2 = _strengths[1].size();
+        const auto* strengths2 = _strengths[1].data();
+        const auto* low_bits2 = _low_bits[1].data();
+        const auto* high_bits2 = _high_bits[1].data();
+        for (std::size_t i = 0; i < _strengths[0].size(); ++i) {
+            const auto s1 = _strengths[0][i];
+            if (s1 == 0) {
+                continue;
+            }
+            const auto low = _low_bits[0][i];
+            const auto high = _high_bits[0][i];
+            auto matchups = std::uint32_t{0};
+            auto wins1 = std::uint32_t{0};
+            auto wins2 = std::uint32_t{0};
+            for (std::size_t j = 0; j < num_combos2; ++j) {
+                const auto s2 = strengths2[j];
+                const auto l2 = low_bits2[j];
+                const auto h2 = high_bits2[j];
+                const std::uint32_t valid = (s2 != 0) & (l2 != low) & (l2 != high) & (h2 != low) & (h2 != high);
+                matchups += valid;
+                wins1 += valid & (s1 > s2);
+                wins2 += valid & (s2 > s1);
+            }
+            tally.matchups += matchups;
+            tally.wins[0] += wins1;
+            tally.wins[1] += wins2;
+            tally.ties += matchups - wins1 - wins2;
+        }
+        ++tally.boards;
+    }
+
+private:
+    static std::uint32_t LowBit(CardSet set) {
+        auto bit = std::uint32_t{0};
+        while (!(set & (CardSet{1} << bit))) {
+            ++bit;
+        }
+        return bit;
+    }
+
+    std::array<const std::vector<CardSet>*, 2> _ranges;
+    std::array<std::vector<std::uint32_t>, 2> _strengths;
+    // Bit index of the lower and higher card of each combination.
+    std::array<std::vector<std::uint32_t>, 2> _low_bits;
+    std::array<std::vector<std::uint32_t>, 2> _high_bits;
+};
+
+std::uint64_t NumCombinations(std::uint64_t n, std::uint64_t k) {
+    auto result = std::uint64_t{1};
+    for (std::uint64_t i = 1; i <= k; ++i) {
+        result = result * (n - k + i) / i;
+    }
+    return result;
+}
+
+std::vector<CardSet> EnumerateBoards(const std::vector<std::int32_t>& deck, std::size_t k, CardSet board) {
+    auto boards = std::vector<CardSet>{};
+    auto indices = std::vector<std::size_t>(k);
+    for (std::size_t i = 0; i < k; ++i) {
+        indices[i] = i;
+    }
+    for (;;) {
+        auto completion = board;
+        for (const auto index : indices) {
+            completion |= CardBit(deck[index]);
+        }
+        boards.push_back(completion);
+        // Advance to the next combination.
+        auto i = k;
+        while (i > 0 && indices[i - 1] == deck.size() - k + i - 1) {
+            --i;
+        }
+        if (i == 0) {
+            return boards;
+        }
+        ++indices[i - 1];
+        for (auto j = i; j < k; ++j) {
+            indices[j] = indices[j - 1] + 1;
+        }
+    }
+}
+
+std::vector<CardSet> SampleBoards(std::vector<std::int32_t> deck, std::size_t k, CardSet board,
+                                  std::uint64_t count, std::uint64_t seed) {
+    auto rng = Xoshiro256{seed};
+    auto boards = std::vector<CardSet>{};
+    boards.reserve(count);
+    for (std::uint64_t n = 0; n < count; ++n) {
+        auto completion = board;
+        for (std::size_t j = 0; j < k; ++j) {
+            const auto r = std::uniform_int_distribution<std::size_t>{j, deck.size() - 1}(rng);
+            std::swap(deck[j], deck[r]);
+            completion |= CardBit(deck[j]);
+        }
+        boards.push_back(completion);
+    }
+    return boards;
+}
+
+std::vector<CardSet> ToCardSets(const std::vector<Combo>& range, CardSet board) {
+    auto sets = std::vector<CardSet>{};
+    for (const auto& combo : range) {
+        if (combo[0] < 0 || combo[0] >= num_cards || combo[1] < 0 || combo[1] >= num_cards || combo[0] == combo[1]) {
+            throw std::invalid_argument{"Invalid combination in range"};
+        }
+        const auto set = CardBit(combo[0]) | CardBit(combo[1]);
+        if (!(set & board)) {
+            sets.push_back(set);
+        }
+    }
+    if (sets.empty()) {
+        throw std::invalid_argument{"A range has no combination left on this board"};
+    }
+    return sets;
+}
+
+void Finish(const Tally& tally, RangeEquityResult& result) {
+    result.num_boards = tally.boards;
+    result.num_matchups = tally.matchups;
+    const auto matchups = static_cast<double>(std::max<std::uint64_t>(1, tally.matchups));
+    for (std::size_t r = 0; r < 2; ++r) {
+        result.win[r] = static_cast<double>(tally.wins[r]) / matchups;
+        result.tie[r] = static_cast<double>(tally.ties) / matchups;
+        result.equity[r] = result.win[r] + result.tie[r] / 2.0;
+        const auto hands = static_cast<double>(std::max<std::uint64_t>(1, tally.hands[r]));
+        for (std::size_t c = 0; c < num_hand_categories; ++c) {
+            result.categories[r][c] = static_cast<double>(tally.categories[r][c]) / hands;
+        }
+    }
+}
+
+} // namespace
+
+RangeEquityResult ComputeRangeEquity(const std::vector<Combo>& range1, const std::vector<Combo>& range2,
+                                     const std::vector<std::int32_t>& board, std::uint64_t max_boards,
+                                     unsigned num_threads, std::uint64_t seed,
+                                     const RangeEquityProgress& progress) {
+    if (board.size() > 5) {
+        throw std::invalid_argument{"The board can have at most 5 cards"};
+    }
+    if (num_threads == 0) {
+        throw std::invalid_argument{"Number of threads must be positive"};
+    }
+    if (max_boards == 0) {
+        throw std::invalid_argument{"Number of boards must be positive"};
+    }
+    auto board_set = CardSet{0};
+    for (const auto card : board) {
+        if (card < 0 || card >= num_cards) {
+            throw std::invalid_argument{"Invalid card"};
+        }
+        if (board_set & CardBit(card)) {
+            throw std::invalid_argument{"Duplicate card"};
+        }
+        board_set |= CardBit(card);
+    }
+
+    auto result = RangeEquityResult{};
+    const auto hands1 = ToCardSets(range1, board_set);
+    const auto hands2 = ToCardSets(range2, board_set);
+    result.num_combos = {hands1.size(), hands2.size()};
+
+    auto deck = std::vector<std::int32_t>{};
+    for (std::int32_t card = 0; card < num_cards; ++card) {
+        if (!(board_set & CardBit(card))) {
+            deck.push_back(card);
+        }
+    }
+    const auto k = 5 - board.size();
+    result.exhaustive = NumCombinations(deck.size(), k) <= max_boards;
+    const auto boards = result.exhaustive
+        ? EnumerateBoards(deck, k, board_set)
+        : SampleBoards(deck, k, board_set, max_boards, seed);
+    result.total_boards = boards.size();
+
+    // Threads take chunks of boards and add their tally to the total after each chunk.
+    constexpr std::size_t chunk_size = 16;
+    const auto progress_step = std::max<std::uint64_t>(1, boards.size() / 100);
+    auto next = std::atomic<std::size_t>{0};
+    auto total = Tally{};
+    auto next_progress = progress_step;
+    auto mutex = std::mutex{};
+
+    num_threads = static_cast<unsigned>(std::min<std::size_t>(num_threads, (boards.size() + chunk_size - 1) / chunk_size));
+    auto errors = std::vector<std::exception_ptr>(num_threads);
+    auto threads = std::vector<std::thread>{};
+    for (unsigned t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            try {
+                auto matchups = Matchups{hands1, hands2};
+                for (;;) {
+                    const auto begin = next.fetch_add(chunk_size);
+                    if (begin >= boards.size()) {
+                        break;
+                    }
+                    const auto end = std::min(begin + chunk_size, boards.size());
+                    auto tally = Tally{};
+                    for (auto i = begin; i < end; ++i) {
+                        matchups(boards[i], tally);
+                    }
+
+                    const auto lock = std::lock_guard<std::mutex>{mutex};
+                    total += tally;
+                    if (progress && total.boards >= next_progress && total.boards < boards.size()) {
+                        next_progress = total.boards + progress_step;
+                        auto partial = result;
+                        Finish(total, partial);
+                        progress(partial);
+                    }
+                }
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    Finish(total, result);
+    return result;
+}
@@ -0,0 +1,42 @@
+#ifndef RANGE_EQUITY_H
+#define RANGE_EQUITY_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "HandEvaluator.h"
+#include "Range.h"
+
+constexpr std::size_t num_hand_categories = static_cast<std::size_t>(HandCategory::straight_flush) + 1;
+
+struct RangeEquityResult {
+    std::array<double, 2> win{};    // probability of winning outright
+    std::array<double, 2> tie{};    // probability of splitting the pot
+    std::array<double, 2> equity{}; // expected share of the pot
+
+    // Share of the hands of each range, over all its combinations and boards, that make each category.
+    std::array<std::array<double, num_hand_categories>, 2> categories{};
+
+    std::array<std::size_t, 2> num_combos{}; // combinations left once those using a board card are removed
+    std::uint64_t num_boards = 0;            // boards evaluated
+    std::uint64_t total_boards = 0;          // boards to evaluate
+    std::uint64_t num_matchups = 0;          // pairs of combinations compared
+    bool exhaustive = false;
+};
+
+// Receives the result over the boards evaluated so far. Called from the worker threads, one call at a time.
+using RangeEquityProgress = std::function<void(const RangeEquityResult&)>;
+
+// Computes the equity of two ranges on a board of 0 to 5 cards. Every board completion is enumerated when
+// there are at most max_boards of them; otherwise max_boards completions are sampled. For each board the
+// hands of both ranges are evaluated once, then every pair of combinations which share no card is compared,
+// so all pairs are weighted equally. The boards are shared out among num_threads threads. progress, if set,
+// is called about every percent of the boards.
+RangeEquityResult ComputeRangeEquity(const std::vector<Combo>& range1, const std::vector<Combo>& range2,
+                                     const std::vector<std::int32_t>& board, std::uint64_t max_boards,
+                                     unsigned num_threads, std::uint64_t seed,
+                                     const RangeEquityProgress& progress = {});
+
+#endif // RANGE_EQUITY_H
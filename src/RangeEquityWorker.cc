@@ -0,0 +1,168 @@
+#include "RangeEquityWorker.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+#include "Conversions.h"
+#include "Rng.h"
+
+namespace {
+
+RangeEquityWorker::RangeSpec ToRangeSpec(Napi::Env env, Napi::Value value) {
+    auto spec = RangeEquityWorker::RangeSpec{};
+    if (value.IsString()) {
+        spec.notation = value.As<Napi::String>().Utf8Value();
+    } else if (value.IsArray()) {
+        auto array = value.As<Napi::Array>();
+        for (std::uint32_t i = 0; i < array.Length(); ++i) {
+            const auto hole_cards = ToHoleCards(env, array.Get(i));
+            spec.combos.push_back({std::max(hole_cards[0], hole_cards[1]), std::min(hole_cards[0], hole_cards[1])});
+        }
+    } else {
+        throw Napi::TypeError::New(env, "Expected a range as a String or an Array of hole cards");
+    }
+    return spec;
+}
+
+Napi::Object ToObject(Napi::Env env, const RangeEquityResult& result) {
+    const auto to_array = [&](const std::array<double, 2>& values) {
+        auto array = Napi::Array::New(env, 2);
+        array.Set(0u, Napi::Number::New(env, values[0]));
+        array.Set(1u, Napi::Number::New(env, values[1]));
+        return array;
+    };
+    auto categories = Napi::Array::New(env, 2);
+    auto combos = Napi::Array::New(env, 2);
+    for (std::uint32_t r = 0; r < 2; ++r) {
+        auto histogram = Napi::Float64Array::New(env, num_hand_categories);
+        std::copy(result.categories[r].begin(), result.categories[r].end(), histogram.Data());
+        categories.Set(r, histogram);
+        combos.Set(r, Napi::Number::New(env, static_cast<double>(result.num_combos[r])));
+    }
+    auto obj = Napi::Object::New(env);
+    obj.Set("win", to_array(result.win));
+    obj.Set("tie", to_array(result.tie));
+    obj.Set("equity", to_array(result.equity));
+    obj.Set("categories", categories);
+    obj.Set("combos", combos);
+    obj.Set("boards", Napi::Number::New(env, static_cast<double>(result.num_boards)));
+    obj.Set("totalBoards", Napi::Number::New(env, static_cast<double>(result.total_boards)));
+    obj.Set("matchups", Napi::Number::New(env, static_cast<double>(result.num_matchups)));
+    obj.Set("exhaustive", Napi::Boolean::New(env, result.exhaustive));
+    return obj;
+}
+
+} // namespace
+
+Napi::Object RangeEquityWorker::Init(Napi::Env env, Napi::Object exports) {
+    exports.Set("rangeEquity", Napi::Function::New(env, &RangeEquityWorker::RangeEquity, "rangeEquity"));
+    return exports;
+}
+
+Napi::Value RangeEquityWorker::RangeEquity(const Napi::CallbackInfo& info) try {
+    auto env = info.Env();
+    if (info.Length() < 2) {
+        throw Napi::TypeError::New(env, "Expected arguments: (range1, range2[, board[, options]])");
+    }
+
+    auto ranges = std::array<RangeSpec, 2>{ToRangeSpec(env, info[0]), ToRangeSpec(env, info[1])};
+    auto board = info.Length() < 3 || info[2].IsUndefined() || info[2].IsNull()
+        ? std::vector<std::int32_t>{}
+        : ToCards(env, info[2]);
+
+    auto max_boards = std::uint64_t{20000};
+    auto num_threads = std::max(1u, std::thread::hardware_concurrency());
+    auto seed = RandomSeed();
+    auto on_progress = Napi::Function{};
+    if (info.Length() > 3 && info[3].IsObject()) {
+        auto options = info[3].As<Napi::Object>();
+        if (options.Get("boards").IsNumber()) {
+            const auto value = options.Get("boards").As<Napi::Number>().Int64Value();
+            if (value < 1) {
+                throw Napi::RangeError::New(env, "boards must be positive");
+            }
+            max_boards = static_cast<std::uint64_t>(value);
+        }
+        if (options.Get("threads").IsNumber()) {
+            const auto value = options.Get("threads").As<Napi::Number>().Int32Value();
+            if (value < 1) {
+                throw Napi::RangeError::New(env, "threads must be positive");
+            }
+            num_threads = static_cast<unsigned>(value);
+        }
+        if (options.Get("seed").IsNumber()) {
+            seed = static_cast<std::uint64_t>(options.Get("seed").As<Napi::Number>().Int64Value());
+        }
+        if (options.Get("onProgress").IsFunction()) {
+            on_progress = options.Get("onProgress").As<Napi::Function>();
+        }
+    }
+
+    auto worker = new RangeEquityWorker(env, std::move(ranges), std::move(board), max_boards, num_threads, seed,
+                                        on_progress);
+    auto promise = worker->GetPromise();
+    worker->Queue();
+    return promise;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+RangeEquityWorker::RangeEquityWorker(Napi::Env env, std::array<RangeSpec, 2> ranges, std::vector<std::int32_t> board,
+                                     std::uint64_t max_boards, unsigned num_threads, std::uint64_t seed,
+                                     Napi::Function on_progress)
+    : Napi::AsyncWorker(env)
+    , _deferred(Napi::Promise::Deferred::New(env))
+    , _ranges(std::move(ranges))
+    , _board(std::move(board))
+    , _max_boards(max_boards)
+    , _num_threads(num_threads)
+    , _seed(seed)
+    , _has_progress(!on_progress.IsEmpty())
+{
+    if (_has_progress) {
+        _progress = Napi::ThreadSafeFunction::New(env, on_progress, "rangeEquityProgress", 0, 1);
+    }
+}
+
+Napi::Promise RangeEquityWorker::GetPromise() const {
+    return _deferred.Promise();
+}
+
+void RangeEquityWorker::Execute() {
+    try {
+        for (auto& range : _ranges) {
+            if (range.combos.empty()) {
+                range.combos = ParseRange(range.notation);
+            }
+        }
+        auto progress = RangeEquityProgress{};
+        if (_has_progress) {
+            progress = [this](const RangeEquityResult& partial) {
+                auto data = new RangeEquityResult(partial);
+                const auto status = _progress.NonBlockingCall(data, [](Napi::Env env, Napi::Function callback, RangeEquityResult* data) {
+                    callback.Call({ ToObject(env, *data) });
+                    delete data;
+                });
+                if (status != napi_ok) {
+                    delete data;
+                }
+            };
+        }
+        _result = ComputeRangeEquity(_ranges[0].combos, _ranges[1].combos, _board, _max_boards, _num_threads, _seed,
+                                     progress);
+    } catch (const std::exception& e) {
+        SetError(e.what());
+    }
+    if (_has_progress) {
+        _progress.Release();
+    }
+}
+
+void RangeEquityWorker::OnOK() {
+    _deferred.Resolve(ToObject(Env(), _result));
+}
+
+void RangeEquityWorker::OnError(const Napi::Error& e) {
+    _deferred.Reject(e.Value());
+}
@@ -0,0 +1,47 @@
+#ifndef RANGE_EQUITY_WORKER_H
+#define RANGE_EQUITY_WORKER_H
+
+#include <napi.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "RangeEquity.h"
+
+// Computes range-vs-range equity off the JS thread. Partial results are passed to an optional progress
+// callback through a thread-safe function while the boards are evaluated.
+class RangeEquityWorker : public Napi::AsyncWorker {
+public:
+    // A range given as a string is parsed by Execute, so that an invalid range rejects the promise.
+    struct RangeSpec {
+        std::string notation;
+        std::vector<Combo> combos;
+    };
+
+    static Napi::Object Init(Napi::Env env, Napi::Object exports);
+    static Napi::Value RangeEquity(const Napi::CallbackInfo& info);
+
+    RangeEquityWorker(Napi::Env env, std::array<RangeSpec, 2> ranges, std::vector<std::int32_t> board,
+                      std::uint64_t max_boards, unsigned num_threads, std::uint64_t seed, Napi::Function on_progress);
+
+    Napi::Promise GetPromise() const;
+
+protected:
+    void Execute() override;
+    void OnOK() override;
+    void OnError(const Napi::Error& e) override;
+
+private:
+    Napi::Promise::Deferred _deferred;
+    std::array<RangeSpec, 2> _ranges;
+    std::vector<std::int32_t> _board;
+    std::uint64_t _max_boards;
+    unsigned _num_threads;
+    std::uint64_t _seed;
+    Napi::ThreadSafeFunction _progress;
+    bool _has_progress;
+    RangeEquityResult _result;
+};
+
+#endif // RANGE_EQUITY_WORKER_H
@@ -0,0 +1,104 @@
+#include "Rng.h"
+
+#include <stdexcept>
+
+namespace {
+
+constexpr std::uint32_t Rotl(std::uint32_t x, int k) noexcept {
+    return (x << k) | (x >> (32 - k));
+}
+
+void QuarterRound(std::array<std::uint32_t, 16>& x, int a, int b, int c, int d) noexcept {
+    x[a] += x[b]; x[d] = Rotl(x[d] ^ x[a], 16);
+    x[c] += x[d]; x[b] = Rotl(x[b] ^ x[c], 12);
+    x[a] += x[b]; x[d] = Rotl(x[d] ^ x[a], 8);
+    x[c] += x[d]; x[b] = Rotl(x[b] ^ x[c], 7);
+}
+
+std::array<std::uint32_t, 8> RandomKey() {
+    std::random_device rd;
+    auto key = std::array<std::uint32_t, 8>{};
+    for (auto& word : key) {
+        word = rd();
+    }
+    return key;
+}
+
+std::array<std::uint32_t, 8> ExpandSeed(std::uint64_t seed) {
+    auto sm = SplitMix64{seed};
+    auto key = std::array<std::uint32_t, 8>{};
+    for (std::size_t i = 0; i < key.size(); i += 2) {
+        const auto value = sm();
+        key[i] = static_cast<std::uint32_t>(value);
+        key[i + 1] = static_cast<std::uint32_t>(value >> 32);
+    }
+    return key;
+}
+
+} // namespace
+
+std::uint64_t RandomSeed() {
+    std::random_device rd;
+    return (static_cast<std::uint64_t>(rd()) << 32) | rd();
+}
+
+ChaCha20::ChaCha20(const std::array<std::uint32_t, 8>& key) noexcept
+    : _input{0x61707865, 0x3320646e, 0x79622d32, 0x6b206574}
+    , _block{}
+    , _position(_block.size())
+{
+    for (std::size_t i = 0; i < key.size(); ++i) {
+        _input[4 + i] = key[i];
+    }
+    // 64-bit block counter in words 12-13 and a zero nonce in words 14-15.
+}
+
+void ChaCha20::Refill() noexcept {
+    _block = _input;
+    for (auto i = 0; i < 10; ++i) {
+        QuarterRound(_block, 0, 4, 8, 12);
+        QuarterRound(_block, 1, 5, 9, 13);
+        QuarterRound(_block, 2, 6, 10, 14);
+        QuarterRound(_block, 3, 7, 11, 15);
+        QuarterRound(_block, 0, 5, 10, 15);
+        QuarterRound(_block, 1, 6, 11, 12);
+        QuarterRound(_block, 2, 7, 8, 13);
+        QuarterRound(_block, 3, 4, 9, 14);
+    }
+    for (std::size_t i = 0; i < _block.size(); ++i) {
+        _block[i] += _input[i];
+    }
+    if (++_input[12] == 0) {
+        ++_input[13];
+    }
+    _position = 0;
+}
+
+Rng::Rng(Kind kind) {
+    switch (kind) {
+    case Kind::mt19937:    _engine.emplace<std::mt19937>(std::random_device{}()); break;
+    case Kind::xoshiro256: _engine.emplace<Xoshiro256>(RandomSeed()); break;
+    case Kind::chacha20:   _engine.emplace<ChaCha20>(RandomKey()); break;
+    default: throw std::invalid_argument{"Invalid Rng::Kind"};
+    }
+}
+
+Rng::Rng(Kind kind, std::uint64_t seed) {
+    switch (kind) {
+    case Kind::mt19937: {
+        std::seed_seq seq{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+        _engine.emplace<std::mt19937>(seq);
+        break;
+    }
+    case Kind::xoshiro256: _engine.emplace<Xoshiro256>(seed); break;
+    case Kind::chacha20:   _engine.emplace<ChaCha20>(ExpandSeed(seed)); break;
+    default: throw std::invalid_argument{"Invalid Rng::Kind"};
+    }
+}
+
+Rng::Kind Rng::ParseKind(const std::string& name) {
+    if (name == "mt19937") return Kind::mt19937;
+    if (name == "xoshiro256") return Kind::xoshiro256;
+    if (name == "chacha20") return Kind::chacha20;
+    throw std::invalid_argument{"Invalid rng: " + name};
+}
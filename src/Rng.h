@@ -0,0 +1,136 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <variant>
+
+// SplitMix64, used to expand a 64-bit seed into the state of the other generators.
+class SplitMix64 {
+public:
+    using result_type = std::uint64_t;
+
+    explicit SplitMix64(std::uint64_t seed) noexcept : _state(seed) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() noexcept {
+        auto z = (_state += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+private:
+    std::uint64_t _state;
+};
+
+// xoshiro256**: a fast, small-state generator for simulations. Not suitable for real-money games.
+class Xoshiro256 {
+public:
+    using result_type = std::uint64_t;
+
+    explicit Xoshiro256(std::uint64_t seed) noexcept {
+        auto sm = SplitMix64{seed};
+        for (auto& word : _state) {
+            word = sm();
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() noexcept {
+        const auto result = Rotl(_state[1] * 5, 7) * 9;
+        const auto t = _state[1] << 17;
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= t;
+        _state[3] = Rotl(_state[3], 45);
+        return result;
+    }
+
+    // Advances the generator by 2^128 steps, giving a non-overlapping stream to each thread.
+    void Jump() noexcept {
+        constexpr std::uint64_t jump[] = { 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c };
+        auto state = std::array<std::uint64_t, 4>{};
+        for (const auto word : jump) {
+            for (auto b = 0; b < 64; ++b) {
+                if (word & (std::uint64_t{1} << b)) {
+                    for (std::size_t i = 0; i < state.size(); ++i) {
+                        state[i] ^= _state[i];
+                    }
+                }
+                (*this)();
+            }
+        }
+        _state = state;
+    }
+
+private:
+    static constexpr std::uint64_t Rotl(std::uint64_t x, int k) noexcept {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    std::array<std::uint64_t, 4> _state;
+};
+
+// A cryptographically secure generator producing the ChaCha20 keystream of a 256-bit key.
+class ChaCha20 {
+public:
+    using result_type = std::uint32_t;
+
+    explicit ChaCha20(const std::array<std::uint32_t, 8>& key) noexcept;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() noexcept {
+        if (_position == _block.size()) {
+            Refill();
+        }
+        return _block[_position++];
+    }
+
+private:
+    void Refill() noexcept;
+
+    std::array<std::uint32_t, 16> _input;
+    std::array<std::uint32_t, 16> _block;
+    std::size_t _position;
+};
+
+// Returns a seed drawn from std::random_device.
+std::uint64_t RandomSeed();
+
+// The random number generator owned by a table. Any hand dealt from a seeded generator can be dealt again
+// by a generator of the same kind and seed.
+class Rng {
+public:
+    enum class Kind { mt19937, xoshiro256, chacha20 };
+
+    // Seeds the generator from std::random_device.
+    explicit Rng(Kind kind = Kind::mt19937);
+    Rng(Kind kind, std::uint64_t seed);
+
+    // Parses "mt19937", "xoshiro256" or "chacha20". Throws std::invalid_argument otherwise.
+    static Kind ParseKind(const std::string& name);
+
+    Kind kind() const noexcept { return static_cast<Kind>(_engine.index()); }
+
+    template<class F>
+    decltype(auto) Visit(F&& f) {
+        return std::visit(std::forward<F>(f), _engine);
+    }
+
+private:
+    std::variant<std::mt19937, Xoshiro256, ChaCha20> _engine;
+};
+
+#endif // RNG_H
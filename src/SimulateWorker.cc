@@ -0,0 +1,124 @@
+#include "SimulateWorker.h"
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "Conversions.h"
+#include "Rng.h"
+
+Napi::Object SimulateWorker::Init(Napi::Env env, Napi::Object exports) {
+    exports.Set("simulate", Napi::Function::New(env, &SimulateWorker::Simulate, "simulate"));
+    return exports;
+}
+
+Napi::Value SimulateWorker::Simulate(const Napi::CallbackInfo& info) try {
+    auto env = info.Env();
+    if (info.Length() != 3 || !info[0].IsObject() || !info[2].IsNumber()) {
+        throw Napi::TypeError::New(env, "Expected 3 arguments: (config, policy, numHands)");
+    }
+
+    auto config = SimulationConfig{};
+    auto obj = info[0].As<Napi::Object>();
+    if (!obj.Get("forcedBets").IsObject() || !obj.Get("buyIns").IsArray()) {
+        throw Napi::TypeError::New(env, "Expected config with forcedBets and buyIns");
+    }
+    auto forced_bets = obj.Get("forcedBets").As<Napi::Object>();
+    if (!forced_bets.Get("ante").IsNumber() || !forced_bets.Get("smallBlind").IsNumber()
+        || !forced_bets.Get("bigBlind").IsNumber()) {
+        throw Napi::TypeError::New(env, "Expected forcedBets with ante, smallBlind and bigBlind");
+    }
+    config.ante = forced_bets.Get("ante").As<Napi::Number>().Int32Value();
+    config.small_blind = forced_bets.Get("smallBlind").As<Napi::Number>().Int32Value();
+    config.big_blind = forced_bets.Get("bigBlind").As<Napi::Number>().Int32Value();
+
+    auto buy_ins = obj.Get("buyIns").As<Napi::Array>();
+    if (buy_ins.Length() > poker::table::num_seats) {
+        throw Napi::RangeError::New(env, "Too many seats in buyIns");
+    }
+    auto num_players = 0;
+    for (uint32_t i = 0; i < buy_ins.Length(); ++i) {
+        const auto buy_in = buy_ins.Get(i);
+        if (buy_in.IsNumber() && buy_in.As<Napi::Number>().Int32Value() > 0) {
+            config.buy_ins[i] = buy_in.As<Napi::Number>().Int32Value();
+            ++num_players;
+        }
+    }
+    if (num_players < 2) {
+        throw Napi::RangeError::New(env, "At least 2 seats must have a buy-in");
+    }
+
+    if (info[1].IsArray()) {
+        auto policies = info[1].As<Napi::Array>();
+        for (uint32_t i = 0; i < policies.Length() && i < poker::table::num_seats; ++i) {
+            if (config.buy_ins[i] != 0) {
+                config.policies[i] = ToPolicy(env, policies.Get(i));
+            }
+        }
+    } else {
+        config.policies.fill(ToPolicy(env, info[1]));
+    }
+
+    const auto num_hands = info[2].As<Napi::Number>().Int64Value();
+    if (num_hands < 0) {
+        throw Napi::RangeError::New(env, "numHands must be non-negative");
+    }
+    const auto seed = obj.Get("seed").IsNumber()
+        ? static_cast<std::uint64_t>(obj.Get("seed").As<Napi::Number>().Int64Value())
+        : RandomSeed();
+    auto num_threads = std::max(1u, std::thread::hardware_concurrency());
+    if (obj.Get("threads").IsNumber()) {
+        const auto threads = obj.Get("threads").As<Napi::Number>().Int32Value();
+        if (threads < 1) {
+            throw Napi::RangeError::New(env, "threads must be positive");
+        }
+        num_threads = static_cast<unsigned>(threads);
+    }
+
+    auto worker = new SimulateWorker(env, config, num_hands, seed, num_threads);
+    auto promise = worker->GetPromise();
+    worker->Queue();
+    return promise;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+SimulateWorker::SimulateWorker(Napi::Env env, const SimulationConfig& config, std::uint64_t num_hands,
+                               std::uint64_t seed, unsigned num_threads)
+    : Napi::AsyncWorker(env)
+    , _deferred(Napi::Promise::Deferred::New(env))
+    , _config(config)
+    , _num_hands(num_hands)
+    , _seed(seed)
+    , _num_threads(num_threads)
+{
+}
+
+Napi::Promise SimulateWorker::GetPromise() const {
+    return _deferred.Promise();
+}
+
+void SimulateWorker::Execute() {
+    try {
+        _result = SimulateHandsParallel(_config, _num_hands, _seed, _num_threads);
+    } catch (const std::exception& e) {
+        SetError(e.what());
+    }
+}
+
+void SimulateWorker::OnOK() {
+    auto env = Env();
+    auto obj = Napi::Object::New(env);
+    obj.Set("handsPlayed", Napi::Number::New(env, static_cast<double>(_result.hands_played)));
+    obj.Set("showdowns", Napi::Number::New(env, static_cast<double>(_result.showdowns)));
+    auto chips_won = Napi::Array::New(env, poker::table::num_seats);
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        chips_won.Set(i, Napi::Number::New(env, static_cast<double>(_result.chips_won[i])));
+    }
+    obj.Set("chipsWon", chips_won);
+    _deferred.Resolve(obj);
+}
+
+void SimulateWorker::OnError(const Napi::Error& e) {
+    _deferred.Reject(e.Value());
+}
@@ -0,0 +1,33 @@
+#ifndef SIMULATE_WORKER_H
+#define SIMULATE_WORKER_H
+
+#include <napi.h>
+
+#include "Simulator.h"
+
+// Runs whole simulated hands off the JS thread and resolves a Promise with the aggregate results.
+class SimulateWorker : public Napi::AsyncWorker {
+public:
+    static Napi::Object Init(Napi::Env env, Napi::Object exports);
+    static Napi::Value Simulate(const Napi::CallbackInfo& info);
+
+    SimulateWorker(Napi::Env env, const SimulationConfig& config, std::uint64_t num_hands,
+                   std::uint64_t seed, unsigned num_threads);
+
+    Napi::Promise GetPromise() const;
+
+protected:
+    void Execute() override;
+    void OnOK() override;
+    void OnError(const Napi::Error& e) override;
+
+private:
+    Napi::Promise::Deferred _deferred;
+    SimulationConfig _config;
+    std::uint64_t _num_hands;
+    std::uint64_t _seed;
+    unsigned _num_threads;
+    SimulationResult _result;
+};
+
+#endif // SIMULATE_WORKER_H
@@ -0,0 +1,114 @@
+#include "Simulator.h"
+
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+SimulationResult& SimulationResult::operator+=(const SimulationResult& other) {
+    hands_played += other.hands_played;
+    showdowns += other.showdowns;
+    for (std::size_t i = 0; i < chips_won.size(); ++i) {
+        chips_won[i] += other.chips_won[i];
+    }
+    return *this;
+}
+
+namespace {
+
+void Reseat(poker::table& table, const SimulationConfig& config) {
+    auto seats = table.seats();
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        if (config.buy_ins[i] == 0) {
+            continue;
+        }
+        if (seats.occupancy()[i] && seats[i].total_chips() == 0) {
+            table.stand_up(i);
+        }
+        if (!table.seats().occupancy()[i]) {
+            table.sit_down(i, config.buy_ins[i]);
+        }
+    }
+}
+
+std::array<int, poker::table::num_seats> TotalChips(const poker::table& table) {
+    auto chips = std::array<int, poker::table::num_seats>{};
+    auto seats = table.seats();
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        if (seats.occupancy()[i]) {
+            chips[i] = seats[i].total_chips();
+        }
+    }
+    return chips;
+}
+
+} // namespace
+
+HandSimulator::HandSimulator(const SimulationConfig& config, std::uint64_t seed, std::uint64_t stream)
+    : _config(config)
+    , _rng(seed)
+    , _table(poker::forced_bets{poker::blinds{config.small_blind, config.big_blind}, config.ante})
+{
+    for (std::uint64_t i = 0; i < stream; ++i) {
+        _rng.Jump();
+    }
+}
+
+SimulationResult HandSimulator::Play(std::uint64_t num_hands) {
+    const auto policy_of = [&](std::size_t seat) -> const Policy& { return _config.policies[seat]; };
+    auto result = SimulationResult{};
+    for (std::uint64_t n = 0; n < num_hands; ++n) {
+        Reseat(_table, _config);
+        const auto before = TotalChips(_table);
+
+        _table.start_hand(_rng);
+        if (PlayHand(_table, policy_of, _rng)) {
+            ++result.showdowns;
+        }
+
+        const auto after = TotalChips(_table);
+        for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+            result.chips_won[i] += after[i] - before[i];
+        }
+        ++result.hands_played;
+    }
+    return result;
+}
+
+SimulationResult SimulateHands(const SimulationConfig& config, std::uint64_t num_hands,
+                               std::uint64_t seed, std::uint64_t stream) {
+    return HandSimulator{config, seed, stream}.Play(num_hands);
+}
+
+SimulationResult SimulateHandsParallel(const SimulationConfig& config, std::uint64_t num_hands,
+                                       std::uint64_t seed, unsigned num_threads) {
+    if (num_threads == 0) {
+        throw std::invalid_argument{"Number of threads must be positive"};
+    }
+    auto results = std::vector<SimulationResult>(num_threads);
+    auto errors = std::vector<std::exception_ptr>(num_threads);
+    auto threads = std::vector<std::thread>{};
+    threads.reserve(num_threads);
+    for (unsigned i = 0; i < num_threads; ++i) {
+        const auto share = num_hands / num_threads + (i < num_hands % num_threads ? 1 : 0);
+        threads.emplace_back([&, i, share] {
+            try {
+                results[i] = SimulateHands(config, share, seed, i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto total = SimulationResult{};
+    for (unsigned i = 0; i < num_threads; ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        total += results[i];
+    }
+    return total;
+}
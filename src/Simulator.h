@@ -0,0 +1,52 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include <array>
+#include <cstdint>
+
+#include "Policy.h"
+#include "Rng.h"
+
+// Describes the table on which hands are simulated. A buy-in of 0 marks an empty seat. Busted players
+// rebuy for their original buy-in before the next hand.
+struct SimulationConfig {
+    int ante = 0;
+    int small_blind = 0;
+    int big_blind = 0;
+    std::array<int, poker::table::num_seats> buy_ins{};
+    std::array<Policy, poker::table::num_seats> policies{};
+};
+
+struct SimulationResult {
+    std::uint64_t hands_played = 0;
+    std::uint64_t showdowns = 0;
+    std::array<std::int64_t, poker::table::num_seats> chips_won{};
+
+    SimulationResult& operator+=(const SimulationResult& other);
+};
+
+// Plays hands on a single table a batch at a time, so that long simulations can report results as they go. The
+// deal is fully determined by (seed, stream); streams of the same seed do not overlap.
+class HandSimulator {
+public:
+    HandSimulator(const SimulationConfig& config, std::uint64_t seed, std::uint64_t stream = 0);
+
+    // Plays num_hands more hands and returns the results of those hands only.
+    SimulationResult Play(std::uint64_t num_hands);
+
+private:
+    SimulationConfig _config;
+    Xoshiro256 _rng;
+    poker::table _table;
+};
+
+// Plays num_hands hands on a single table. The deal is fully determined by (seed, stream); streams of the
+// same seed do not overlap.
+SimulationResult SimulateHands(const SimulationConfig& config, std::uint64_t num_hands,
+                               std::uint64_t seed, std::uint64_t stream = 0);
+
+// Splits num_hands across num_threads independent tables and sums up the results.
+SimulationResult SimulateHandsParallel(const SimulationConfig& config, std::uint64_t num_hands,
+                                       std::uint64_t seed, unsigned num_threads);
+
+#endif // SIMULATOR_H
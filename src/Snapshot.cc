@@ -0,0 +1,83 @@
+#include "Snapshot.h"
+
+#include <algorithm>
+
+#include "Card.h"
+
+void WriteSnapshot(const poker::table& table, std::int32_t* out) {
+    using namespace snapshot;
+
+    std::fill(out, out + size, -1);
+
+    const auto in_progress = table.hand_in_progress();
+    auto header_flags = std::int32_t{0};
+    out[version] = layout_version;
+    if (in_progress) {
+        header_flags |= hand_in_progress;
+        out[button] = table.button();
+        out[round_of_betting] = static_cast<std::int32_t>(table.round_of_betting());
+        out[num_active_players] = table.num_active_players();
+        if (table.betting_round_in_progress()) {
+            header_flags |= betting_round_in_progress;
+            out[player_to_act] = table.player_to_act();
+        }
+        if (table.betting_rounds_completed()) {
+            header_flags |= betting_rounds_completed;
+        }
+    }
+    out[flags] = header_flags;
+
+    const auto fb = table.forced_bets();
+    out[ante] = fb.ante;
+    out[small_blind] = fb.blinds.small;
+    out[big_blind] = fb.blinds.big;
+
+    auto table_seats = table.seats();
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        auto* seat = out + seats + i * seat_stride;
+        seat[seat_flags] = 0;
+        if (table_seats.occupancy()[i]) {
+            seat[seat_flags] |= occupied;
+            seat[seat_stack] = table_seats[i].stack();
+            seat[seat_bet] = table_seats[i].bet_size();
+            seat[seat_total_chips] = table_seats[i].total_chips();
+        }
+    }
+
+    out[community_cards] = 0;
+    out[pots] = 0;
+    if (!in_progress) {
+        return;
+    }
+
+    auto hand_players = table.hand_players();
+    auto hole_cards = table.hole_cards();
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        auto* seat = out + seats + i * seat_stride;
+        if (hand_players.filter()[i]) {
+            seat[seat_flags] |= in_hand;
+        }
+        if (hole_cards.filter()[i]) {
+            seat[seat_hole_cards] = CardIndex(hole_cards[i].first);
+            seat[seat_hole_cards + 1] = CardIndex(hole_cards[i].second);
+        }
+    }
+
+    const auto cards = table.community_cards().cards();
+    out[community_cards] = static_cast<std::int32_t>(cards.size());
+    for (std::size_t i = 0; i < cards.size() && i < max_community_cards; ++i) {
+        out[community_cards + 1 + i] = CardIndex(cards[i]);
+    }
+
+    const auto table_pots = table.pots();
+    const auto num_pots = std::min<std::size_t>(table_pots.size(), poker::table::num_seats);
+    out[pots] = static_cast<std::int32_t>(num_pots);
+    for (std::size_t i = 0; i < num_pots; ++i) {
+        auto* pot = out + pots + 1 + i * pot_stride;
+        pot[0] = table_pots[i].size();
+        pot[1] = 0;
+        for (auto seat_index : table_pots[i].eligible_players()) {
+            pot[1] |= 1 << seat_index;
+        }
+    }
+}
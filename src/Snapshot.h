@@ -0,0 +1,62 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#define POKER_THROW_ON_ERROR
+#include "poker/table.hpp"
+
+// Fixed layout of the table state written by WriteSnapshot, in Int32 elements. Fields which are not
+// applicable (e.g. the button when no hand is in progress) hold -1. Keep in sync with poker.js.
+namespace snapshot {
+
+constexpr std::int32_t layout_version = 1;
+
+// Header
+constexpr std::size_t version = 0;
+constexpr std::size_t flags = 1;              // bit 0: hand in progress, 1: betting round in progress, 2: betting rounds completed
+constexpr std::size_t button = 2;
+constexpr std::size_t player_to_act = 3;
+constexpr std::size_t round_of_betting = 4;   // 0 preflop, 1 flop, 2 turn, 3 river
+constexpr std::size_t num_active_players = 5;
+constexpr std::size_t ante = 6;
+constexpr std::size_t small_blind = 7;
+constexpr std::size_t big_blind = 8;
+
+// Seats: num_seats records of seat_stride elements.
+constexpr std::size_t seats = 9;
+constexpr std::size_t seat_stride = 6;
+constexpr std::size_t seat_flags = 0;         // bit 0: occupied, 1: in the hand
+constexpr std::size_t seat_stack = 1;
+constexpr std::size_t seat_bet = 2;
+constexpr std::size_t seat_total_chips = 3;
+constexpr std::size_t seat_hole_cards = 4;    // 2 cards
+
+// Community cards: count followed by 5 cards.
+constexpr std::size_t community_cards = seats + poker::table::num_seats * seat_stride;
+constexpr std::size_t max_community_cards = 5;
+
+// Pots: count followed by num_seats records of [size, eligible player bitmask].
+constexpr std::size_t pots = community_cards + 1 + max_community_cards;
+constexpr std::size_t pot_stride = 2;
+
+constexpr std::size_t size = pots + 1 + poker::table::num_seats * pot_stride;
+
+enum Flags : std::int32_t {
+    hand_in_progress = 1 << 0,
+    betting_round_in_progress = 1 << 1,
+    betting_rounds_completed = 1 << 2
+};
+
+enum SeatFlags : std::int32_t {
+    occupied = 1 << 0,
+    in_hand = 1 << 1
+};
+
+} // namespace snapshot
+
+// Writes the full table state into out, which must hold at least snapshot::size elements.
+void WriteSnapshot(const poker::table& table, std::int32_t* out);
+
+#endif // SNAPSHOT_H
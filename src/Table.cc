@@ -1,17 +1,68 @@
 #include "Table.h"
 
-#include <random>
+#include "AddonData.h"
+#include "Command.h"
+#include "Conversions.h"
+#include "Explore.h"
+#include "HandEvaluator.h"
+#include "Metrics.h"
+#include "Snapshot.h"
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
 #include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// Strings returned by the observers, kept in AddonData.
+namespace interned {
+
+void Init(Napi::Reference<Napi::Array>& reference, Napi::Env env, std::initializer_list<const char*> strings) {
+    auto arr = Napi::Array::New(env, strings.size());
+    auto i = 0u;
+    for (const auto string : strings) {
+        arr.Set(i++, Napi::String::New(env, string));
+    }
+    reference = Napi::Persistent(arr);
+}
+
+Napi::Value Get(const Napi::Reference<Napi::Array>& reference, std::uint32_t index) {
+    return reference.Value().Get(index);
+}
+
+} // namespace interned
+
+// Integer codes of the automatic actions accepted by setAutomaticAction and exported as poker.AutomaticAction.
+enum class AutomaticActionCode : std::int32_t {
+    fold,
+    check_fold,
+    check,
+    call,
+    call_any,
+    all_in
+};
+
+poker::table::automatic_action ToAutomaticAction(std::int32_t code) {
+    using automatic_action = poker::table::automatic_action;
+    switch (static_cast<AutomaticActionCode>(code)) {
+    case AutomaticActionCode::fold:       return automatic_action::fold;
+    case AutomaticActionCode::check_fold: return automatic_action::check_fold;
+    case AutomaticActionCode::check:      return automatic_action::check;
+    case AutomaticActionCode::call:       return automatic_action::call;
+    case AutomaticActionCode::call_any:   return automatic_action::call_any;
+    case AutomaticActionCode::all_in:     return automatic_action::all_in;
+    default: throw std::invalid_argument{"Invalid automatic action code"};
+    }
+}
 
 Napi::Value ToValue(Napi::Env env, poker::card_rank rank) {
-    constexpr const char* rank_strings[] = { "2", "3", "4", "5", "6", "7", "8", "9", "T", "J", "Q", "K", "A" };
-    return Napi::String::New(env, rank_strings[static_cast<int>(rank)]);
+    return interned::Get(GetAddonData(env).ranks, static_cast<std::uint32_t>(rank));
 }
 
 Napi::Value ToValue(Napi::Env env, poker::card_suit suit) {
-    /* constexpr const char* suit_strings[] = { u8"\u2663", u8"\u2666", u8"\u2665", u8"\u2660" }; */
-    constexpr const char* suit_strings[] = { "clubs", "diamonds", "hearts", "spades" };
-    return Napi::String::New(env, suit_strings[static_cast<int>(suit)]);
+    return interned::Get(GetAddonData(env).suits, static_cast<std::uint32_t>(suit));
 }
 
 Napi::Value ToValue(Napi::Env env, const poker::card& c) {
@@ -46,37 +97,32 @@ Napi::Value ToValue(Napi::Env env, const poker::community_cards& cc) {
 }
 
 Napi::Value ToValue(Napi::Env env, const poker::round_of_betting& rob) {
-    constexpr const char* rob_strings[] = { "preflop", "flop", "turn", "river" };
     switch (rob) {
-    case poker::round_of_betting::preflop: return Napi::String::New(env, "preflop");
-    case poker::round_of_betting::flop:    return Napi::String::New(env, "flop");
-    case poker::round_of_betting::turn:    return Napi::String::New(env, "turn");
-    case poker::round_of_betting::river:   return Napi::String::New(env, "river");
+    case poker::round_of_betting::preflop:
+    case poker::round_of_betting::flop:
+    case poker::round_of_betting::turn:
+    case poker::round_of_betting::river:
+        return interned::Get(GetAddonData(env).rounds_of_betting, static_cast<std::uint32_t>(rob));
     default: throw std::invalid_argument{"Internal error: invalid round_of_betting object"};
     }
 }
 
 Napi::Value ToValue(Napi::Env env, const poker::table::automatic_action& aa) {
+    auto code = AutomaticActionCode{};
     switch (aa) {
-    case poker::table::automatic_action::fold:       return Napi::String::New(env, "fold");
-    case poker::table::automatic_action::check_fold: return Napi::String::New(env, "check/fold");
-    case poker::table::automatic_action::check:      return Napi::String::New(env, "check");
-    case poker::table::automatic_action::call:       return Napi::String::New(env, "call");
-    case poker::table::automatic_action::call_any:   return Napi::String::New(env, "call any");
-    case poker::table::automatic_action::all_in:     return Napi::String::New(env, "all in");
+    case poker::table::automatic_action::fold:       code = AutomaticActionCode::fold; break;
+    case poker::table::automatic_action::check_fold: code = AutomaticActionCode::check_fold; break;
+    case poker::table::automatic_action::check:      code = AutomaticActionCode::check; break;
+    case poker::table::automatic_action::call:       code = AutomaticActionCode::call; break;
+    case poker::table::automatic_action::call_any:   code = AutomaticActionCode::call_any; break;
+    case poker::table::automatic_action::all_in:     code = AutomaticActionCode::all_in; break;
     default: throw std::invalid_argument{"Internal error: invalid automatic_action object"};
     }
+    return interned::Get(GetAddonData(env).automatic_actions, static_cast<std::uint32_t>(code));
 }
 
 Napi::Value ToValue(Napi::Env env, const poker::dealer::action& a) {
-    switch (a) {
-    case poker::dealer::action::fold:  return Napi::String::New(env, "fold");
-    case poker::dealer::action::check: return Napi::String::New(env, "check");
-    case poker::dealer::action::call:  return Napi::String::New(env, "call");
-    case poker::dealer::action::bet:   return Napi::String::New(env, "bet");
-    case poker::dealer::action::raise: return Napi::String::New(env, "raise");
-    default: throw std::invalid_argument{"Internal error: invalid dealer::action object"};
-    }
+    return interned::Get(GetAddonData(env).actions, static_cast<std::uint32_t>(ToActionCode(a)));
 }
 
 Napi::Value ToValue(Napi::Env env, const poker::chip_range& cr) {
@@ -113,7 +159,24 @@ Napi::Value ToValue(Napi::Env env, const poker::dealer::action_range& ar) {
     return obj;
 }
 
-Napi::FunctionReference Table::constructor;
+// Returns the contents of a Buffer, TypedArray or ArrayBuffer.
+std::pair<const std::uint8_t*, std::size_t> ToBytes(Napi::Env env, Napi::Value value) {
+    if (value.IsTypedArray()) {
+        // Read the data pointer of the view directly: napi_get_arraybuffer_info rejects the SharedArrayBuffer
+        // of a view shared between workers.
+        auto array = value.As<Napi::TypedArray>();
+        void* data = nullptr;
+        if (napi_get_typedarray_info(env, array, nullptr, nullptr, &data, nullptr, nullptr) != napi_ok) {
+            throw Napi::Error::New(env);
+        }
+        return {static_cast<const std::uint8_t*>(data), array.ByteLength()};
+    }
+    if (value.IsArrayBuffer()) {
+        auto buffer = value.As<Napi::ArrayBuffer>();
+        return {static_cast<const std::uint8_t*>(buffer.Data()), buffer.ByteLength()};
+    }
+    throw Napi::TypeError::New(env, "Expected a Buffer, TypedArray or ArrayBuffer");
+}
 
 Napi::Object Table::Init(Napi::Env env, Napi::Object exports) {
     Napi::HandleScope scope(env);
@@ -132,31 +195,95 @@ Napi::Object Table::Init(Napi::Env env, Napi::Object exports) {
         InstanceMethod("roundOfBetting", &Table::GetRoundOfBetting),
         InstanceMethod("communityCards", &Table::GetCommunityCards),
         InstanceMethod("legalActions", &Table::GetLegalActions),
+        InstanceMethod("legalMask", &Table::GetLegalMask),
         InstanceMethod("automaticActions", &Table::GetAutomaticActions),
         InstanceMethod("canSetAutomaticActions", &Table::CanSetAutomaticAction),
         InstanceMethod("legalAutomaticActions", &Table::GetLegalAutomaticActions),
         InstanceMethod("holeCards", &Table::GetHoleCards),
+        InstanceMethod("holeCardSets", &Table::GetHoleCardSets),
+        InstanceMethod("communityCardSet", &Table::GetCommunityCardSet),
+        InstanceMethod("snapshot", &Table::Snapshot),
+        InstanceMethod("serialize", &Table::Serialize),
+        InstanceMethod("fork", &Table::Fork),
+        InstanceMethod("explore", &Table::Explore),
 
         InstanceMethod("setForcedBets", &Table::SetForcedBets),
         InstanceMethod("sitDown", &Table::SitDown),
         InstanceMethod("standUp", &Table::StandUp),
         InstanceMethod("startHand", &Table::StartHand),
         InstanceMethod("actionTaken", &Table::ActionTaken),
+        InstanceMethod("tryAction", &Table::TryAction),
         InstanceMethod("endBettingRound", &Table::EndBettingRound),
         InstanceMethod("showdown", &Table::Showdown),
-        InstanceMethod("setAutomaticAction", &Table::SetAutomaticAction)
+        InstanceMethod("setAutomaticAction", &Table::SetAutomaticAction),
+        InstanceMethod("enableEvents", &Table::EnableEvents),
+        InstanceMethod("drainEvents", &Table::DrainEvents),
+        InstanceMethod("recordHistory", &Table::RecordHistory),
+        InstanceMethod("flushHistory", &Table::FlushHistory),
+        InstanceMethod("setPolicy", &Table::SetPolicy),
+        InstanceMethod("advance", &Table::Advance),
+        InstanceMethod("applyBatch", &Table::ApplyBatch),
+        InstanceMethod("batchError", &Table::GetBatchError),
+        StaticMethod("deserialize", &Table::Deserialize)
         });
 
-    constructor = Napi::Persistent(func);
-    constructor.SuppressDestruct();
+    auto& data = GetAddonData(env);
+    data.table_constructor = Napi::Persistent(func);
+
+    interned::Init(data.ranks, env, { "2", "3", "4", "5", "6", "7", "8", "9", "T", "J", "Q", "K", "A" });
+    interned::Init(data.suits, env, { "clubs", "diamonds", "hearts", "spades" });
+    interned::Init(data.rounds_of_betting, env, { "preflop", "flop", "turn", "river" });
+    interned::Init(data.automatic_actions, env, { "fold", "check/fold", "check", "call", "call any", "all in" });
+    interned::Init(data.actions, env, { "fold", "check", "call", "bet", "raise" });
+
+    auto action = Napi::Object::New(env);
+    action.Set("FOLD", static_cast<int32_t>(ActionCode::fold));
+    action.Set("CHECK", static_cast<int32_t>(ActionCode::check));
+    action.Set("CALL", static_cast<int32_t>(ActionCode::call));
+    action.Set("BET", static_cast<int32_t>(ActionCode::bet));
+    action.Set("RAISE", static_cast<int32_t>(ActionCode::raise));
+
+    auto automatic_action = Napi::Object::New(env);
+    automatic_action.Set("FOLD", static_cast<int32_t>(AutomaticActionCode::fold));
+    automatic_action.Set("CHECK_FOLD", static_cast<int32_t>(AutomaticActionCode::check_fold));
+    automatic_action.Set("CHECK", static_cast<int32_t>(AutomaticActionCode::check));
+    automatic_action.Set("CALL", static_cast<int32_t>(AutomaticActionCode::call));
+    automatic_action.Set("CALL_ANY", static_cast<int32_t>(AutomaticActionCode::call_any));
+    automatic_action.Set("ALL_IN", static_cast<int32_t>(AutomaticActionCode::all_in));
+
+    auto action_status = Napi::Object::New(env);
+    action_status.Set("OK", static_cast<int32_t>(ActionStatus::ok));
+    action_status.Set("NO_BETTING_ROUND", static_cast<int32_t>(ActionStatus::no_betting_round));
+    action_status.Set("INVALID_ACTION_CODE", static_cast<int32_t>(ActionStatus::invalid_action_code));
+    action_status.Set("ILLEGAL_ACTION", static_cast<int32_t>(ActionStatus::illegal_action));
+    action_status.Set("INVALID_BET_SIZE", static_cast<int32_t>(ActionStatus::invalid_bet_size));
 
     exports.Set("Table", func);
+    exports.Set("SNAPSHOT_SIZE", Napi::Number::New(env, snapshot::size));
+    exports.Set("Action", action);
+    exports.Set("AutomaticAction", automatic_action);
+    exports.Set("ActionStatus", action_status);
+    exports.Set("replay", Napi::Function::New(env, &Table::Replay, "replay"));
+    exports.Set("metrics", Napi::Function::New(env, &Table::GetMetrics, "metrics"));
+
+    auto metric_methods = Napi::Array::New(env, metrics::num_methods);
+    for (std::size_t i = 0; i < metrics::num_methods; ++i) {
+        metric_methods.Set(static_cast<std::uint32_t>(i), Napi::String::New(env, metrics::method_names[i]));
+    }
+    auto metric_bucket_bounds = Napi::Float64Array::New(env, metrics::num_buckets);
+    for (std::size_t i = 0; i < metrics::num_buckets; ++i) {
+        metric_bucket_bounds[i] = static_cast<double>(metrics::BucketUpperBound(i));
+    }
+    exports.Set("METRICS_SIZE", Napi::Number::New(env, metrics::size));
+    exports.Set("METRIC_METHODS", metric_methods);
+    exports.Set("METRIC_BUCKET_BOUNDS", metric_bucket_bounds);
     return exports;
 }
 
 Table::Table(const Napi::CallbackInfo& info) try
     : Napi::ObjectWrap<Table>(info)
 {
+    POKER_METRICS_SCOPE(construct);
     Napi::Env env = info.Env();
     Napi::HandleScope scope(env);
 
@@ -171,11 +298,27 @@ Table::Table(const Napi::CallbackInfo& info) try
     const auto big_blind = obj.Get("bigBlind").As<Napi::Number>();
 
     new (&_table) poker::table{poker::forced_bets{poker::blinds{small_blind, big_blind}, ante}};
+
+    const auto kind = obj.Get("rng").IsString()
+        ? Rng::ParseKind(obj.Get("rng").As<Napi::String>().Utf8Value())
+        : Rng::Kind::mt19937;
+    if (obj.Get("seed").IsNumber()) {
+        const auto seed = static_cast<std::uint64_t>(obj.Get("seed").As<Napi::Number>().Int64Value());
+        _rng = Rng{kind, seed};
+        // A stream of its own keeps the cards dealt independent of the decisions of the policies.
+        _policy_rng.emplace(SplitMix64{seed}());
+    } else if (kind != Rng::Kind::mt19937) {
+        _rng = Rng{kind};
+    }
+    if (obj.Get("journal").IsUndefined() || obj.Get("journal").ToBoolean()) {
+        _journal = std::make_unique<HandHistoryWriter>(_table);
+    }
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 Napi::Value Table::GetSeats(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(seats);
     auto array = Napi::Array::New(info.Env(), poker::table::num_seats);
     auto seats = _table.seats();
     for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
@@ -191,6 +334,7 @@ Napi::Value Table::GetSeats(const Napi::CallbackInfo& info) try {
 }
 
 Napi::Value Table::GetForcedBets(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(forced_bets);
     const auto fb = _table.forced_bets();
     auto obj = Napi::Object::New(info.Env());
     obj.Set("ante", Napi::Number::New(info.Env(), fb.ante));
@@ -202,24 +346,28 @@ Napi::Value Table::GetForcedBets(const Napi::CallbackInfo& info) try {
 }
 
 Napi::Value Table::IsHandInProgress(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(is_hand_in_progress);
     return Napi::Boolean::New(info.Env(), _table.hand_in_progress());
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 Napi::Value Table::IsBettingRoundInProgress(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(is_betting_round_in_progress);
     return Napi::Boolean::New(info.Env(), _table.betting_round_in_progress());
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 Napi::Value Table::AreBettingRoundsCompleted(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(are_betting_rounds_completed);
     return Napi::Boolean::New(info.Env(), _table.betting_rounds_completed());
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 Napi::Value Table::GetHandPlayers(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(hand_players);
     auto array = Napi::Array::New(info.Env(), poker::table::num_seats);
     auto players = _table.hand_players();
     for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
@@ -235,24 +383,28 @@ Napi::Value Table::GetHandPlayers(const Napi::CallbackInfo& info) try {
 }
 
 Napi::Value Table::GetButton(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(button);
     return Napi::Number::New(info.Env(), _table.button());
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 Napi::Value Table::GetPlayerToAct(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(player_to_act);
     return Napi::Number::New(info.Env(), _table.player_to_act());
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 Napi::Value Table::GetNumActivePlayers(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(num_active_players);
     return Napi::Number::New(info.Env(), _table.num_active_players());
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 Napi::Value Table::GetPots(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(pots);
     auto pots = _table.pots();
     auto pot_array = Napi::Array::New(info.Env());
     for (auto i = 0; i < pots.size(); ++i) {
@@ -271,24 +423,55 @@ Napi::Value Table::GetPots(const Napi::CallbackInfo& info) try {
 }
 
 Napi::Value Table::GetRoundOfBetting(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(round_of_betting);
     return ToValue(info.Env(), _table.round_of_betting());
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 Napi::Value Table::GetCommunityCards(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(community_cards);
     return ToValue(info.Env(), _table.community_cards());
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 Napi::Value Table::GetLegalActions(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(legal_actions);
     return ToValue(info.Env(), _table.legal_actions());
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
+Napi::Value Table::GetLegalMask(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(legal_mask);
+    auto buffer = Napi::Int32Array{};
+    if (info.Length() == 0) {
+        buffer = Napi::Int32Array::New(info.Env(), 3);
+    } else if (info[0].IsTypedArray() && info[0].As<Napi::TypedArray>().TypedArrayType() == napi_int32_array
+               && info[0].As<Napi::Int32Array>().ElementLength() >= 3) {
+        buffer = info[0].As<Napi::Int32Array>();
+    } else {
+        throw Napi::TypeError::New(info.Env(), "Expected an Int32Array of at least 3 elements");
+    }
+    auto* out = buffer.Data();
+    if (_table.hand_in_progress() && _table.betting_round_in_progress()) {
+        const auto legal = _table.legal_actions();
+        const auto mask = LegalActionMask(legal);
+        const auto sized = mask & ((1 << static_cast<int>(ActionCode::bet)) | (1 << static_cast<int>(ActionCode::raise)));
+        out[0] = mask;
+        out[1] = sized ? static_cast<std::int32_t>(legal.chip_range.min) : 0;
+        out[2] = sized ? static_cast<std::int32_t>(legal.chip_range.max) : 0;
+    } else {
+        out[0] = out[1] = out[2] = 0;
+    }
+    return buffer;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
 Napi::Value Table::GetAutomaticActions(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(automatic_actions);
     auto aa = _table.automatic_actions();
     auto array = Napi::Array::New(info.Env(), poker::table::num_seats);
     for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
@@ -304,6 +487,7 @@ Napi::Value Table::GetAutomaticActions(const Napi::CallbackInfo& info) try {
 }
 
 Napi::Value Table::CanSetAutomaticAction(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(can_set_automatic_actions);
     if (info.Length() != 1 && !info[0].IsNumber()) {
         Napi::TypeError::New(info.Env(), "Expected 1 argument of type Number").ThrowAsJavaScriptException();
     }
@@ -314,6 +498,7 @@ Napi::Value Table::CanSetAutomaticAction(const Napi::CallbackInfo& info) try {
 }
 
 Napi::Value Table::GetLegalAutomaticActions(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(legal_automatic_actions);
     using automatic_action = poker::table::automatic_action;
     if (info.Length() != 1 && !info[0].IsNumber()) {
         Napi::TypeError::New(info.Env(), "Expected 1 argument of type Number").ThrowAsJavaScriptException();
@@ -347,6 +532,7 @@ Napi::Value Table::GetLegalAutomaticActions(const Napi::CallbackInfo& info) try
 }
 
 Napi::Value Table::GetHoleCards(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(hole_cards);
     const auto hole_cards = _table.hole_cards();
     auto array = Napi::Array::New(info.Env());
     for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
@@ -361,7 +547,57 @@ Napi::Value Table::GetHoleCards(const Napi::CallbackInfo& info) try {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
+Napi::Value Table::GetHoleCardSets(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(hole_card_sets);
+    const auto hole_cards = _table.hole_cards();
+    auto array = Napi::BigUint64Array::New(info.Env(), poker::table::num_seats);
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        array[i] = hole_cards.filter()[i]
+            ? CardBit(CardIndex(hole_cards[i].first)) | CardBit(CardIndex(hole_cards[i].second))
+            : CardSet{0};
+    }
+    return array;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Table::GetCommunityCardSet(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(community_card_set);
+    auto cards = CardSet{0};
+    for (const auto& card : _table.community_cards().cards()) {
+        cards |= CardBit(CardIndex(card));
+    }
+    return Napi::BigInt::New(info.Env(), static_cast<std::uint64_t>(cards));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Table::Snapshot(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(snapshot);
+    if (info.Length() != 1 || !info[0].IsTypedArray()
+        || info[0].As<Napi::TypedArray>().TypedArrayType() != napi_int32_array
+        || info[0].As<Napi::Int32Array>().ElementLength() < snapshot::size) {
+        throw Napi::TypeError::New(info.Env(), "Expected 1 argument of type Int32Array with at least SNAPSHOT_SIZE elements");
+    }
+    auto buffer = info[0].As<Napi::Int32Array>();
+    WriteSnapshot(_table, buffer.Data());
+    return buffer;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+template<class F>
+void Table::Log(F&& write) {
+    if (_history) {
+        write(*_history);
+    }
+    if (_journal) {
+        write(*_journal);
+    }
+}
+
 void Table::SetForcedBets(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(set_forced_bets);
     if (info.Length() != 1 || !info[0].IsObject()) {
         Napi::TypeError::New(info.Env(), "Expected 1 argument").ThrowAsJavaScriptException();
     }
@@ -371,93 +607,312 @@ void Table::SetForcedBets(const Napi::CallbackInfo& info) try {
     const auto big_blind = obj.Get("bigBlind").As<Napi::Number>();
 
     _table.set_forced_bets({{small_blind, big_blind}, ante});
+    Log([&](HandHistoryWriter& log) {
+        log.ForcedBets(_table.forced_bets());
+    });
+    RecordEvents();
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 void Table::SitDown(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(sit_down);
     if (info.Length() != 2 || !info[0].IsNumber() || !info[1].IsNumber()) {
         Napi::TypeError::New(info.Env(), "Expected 2 arguments of type Number").ThrowAsJavaScriptException();
     }
     auto seat = info[0].As<Napi::Number>().Int32Value();
     auto buy_in = info[1].As<Napi::Number>().Int32Value();
-    _table.sit_down(seat, buy_in);
+    ApplySitDown(seat, buy_in);
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 void Table::StandUp(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(stand_up);
     if (info.Length() != 1 || !info[0].IsNumber()) {
         Napi::TypeError::New(info.Env(), "Expected 1 argument of type Number").ThrowAsJavaScriptException();
     }
     auto seat = info[0].As<Napi::Number>().Int32Value();
-    _table.stand_up(seat);
+    ApplyStandUp(seat);
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 void Table::StartHand(const Napi::CallbackInfo& info) try {
-    static auto rng = std::make_unique<std::mt19937>(std::random_device{}());
-
+    POKER_METRICS_SCOPE(start_hand);
+    auto button = -1;
     if (info.Length() == 1) {
         if (!info[0].IsNumber()) {
-            Napi::TypeError::New(info.Env(), "Invalid argument for button: expected Number").ThrowAsJavaScriptException();
-        } else {
-            const auto button = info[0].As<Napi::Number>().Int32Value();
-            _table.start_hand(*rng, button);
+            throw Napi::TypeError::New(info.Env(), "Invalid argument for button: expected Number");
+        }
+        button = info[0].As<Napi::Number>().Int32Value();
+        if (button < 0 || button >= static_cast<int>(poker::table::num_seats)) {
+            throw Napi::RangeError::New(info.Env(), "Invalid seat index for button");
         }
-    } else {
-        _table.start_hand(*rng);
     }
+    ApplyStartHand(button);
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 void Table::ActionTaken(const Napi::CallbackInfo& info) try {
-    static const std::string actions[] = { "fold", "check", "call", "bet", "raise" };
-    if (info.Length() < 1 || !info[0].IsString()) {
+    POKER_METRICS_SCOPE(action_taken);
+    if (info.Length() < 1 || !(info[0].IsNumber() || info[0].IsString())) {
         Napi::TypeError::New(info.Env(), "Invalid arguments").ThrowAsJavaScriptException();
     }
 
-    auto action = info[0].As<Napi::String>().Utf8Value();
     auto table_action = poker::action{};
-    if (action == actions[0]) table_action = poker::action::fold;
-    else if (action == actions[1]) table_action = poker::action::check;
-    else if (action == actions[2]) table_action = poker::action::call;
-    else if (action == actions[3]) table_action = poker::action::bet;
-    else if (action == actions[4]) table_action = poker::action::raise;
-    else Napi::TypeError::New(info.Env(), "Invalid action").ThrowAsJavaScriptException();
+    if (info[0].IsNumber()) {
+        table_action = ToAction(info[0].As<Napi::Number>().Int32Value());
+    } else {
+        char buffer[16];
+        const auto action = ToStringView(info[0], buffer);
+        if (action == "fold") table_action = poker::action::fold;
+        else if (action == "check") table_action = poker::action::check;
+        else if (action == "call") table_action = poker::action::call;
+        else if (action == "bet") table_action = poker::action::bet;
+        else if (action == "raise") table_action = poker::action::raise;
+        else throw Napi::TypeError::New(info.Env(), "Invalid action");
+    }
 
+    auto bet = 0;
     if (table_action == poker::action::bet || table_action == poker::action::raise) {
         if (info.Length() != 2 || !info[1].IsNumber()) {
             Napi::TypeError::New(info.Env(), "No bet specified").ThrowAsJavaScriptException();
         }
-        const auto bet = info[1].As<Napi::Number>().Int32Value();
-        _table.action_taken(table_action, bet);
-    } else {
-        _table.action_taken(table_action);
+        bet = info[1].As<Napi::Number>().Int32Value();
     }
+    ApplyAction({table_action, bet});
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Table::TryAction(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(try_action);
+    if (info.Length() < 1 || !info[0].IsNumber() || (info.Length() > 1 && !info[1].IsNumber())) {
+        throw Napi::TypeError::New(info.Env(), "Expected arguments (action[, betSize]) of type Number");
+    }
+    const auto code = info[0].As<Napi::Number>().Int32Value();
+    const auto bet = info.Length() > 1 ? info[1].As<Napi::Number>().Int32Value() : 0;
+    const auto status = CheckAction(_table, code, bet);
+    if (status == ActionStatus::ok) {
+        const auto action = ToAction(code);
+        ApplyAction({action, action == poker::action::bet || action == poker::action::raise ? bet : 0});
+    }
+    return Napi::Number::New(info.Env(), static_cast<std::int32_t>(status));
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 void Table::EndBettingRound(const Napi::CallbackInfo& info) try {
-    _table.end_betting_round();
+    POKER_METRICS_SCOPE(end_betting_round);
+    ApplyEndBettingRound();
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 void Table::Showdown(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(showdown);
+    ApplyShowdown();
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+void Table::ApplySitDown(int seat, int buy_in) {
+    _table.sit_down(seat, buy_in);
+    Log([&](HandHistoryWriter& log) {
+        log.SitDown(seat, buy_in);
+    });
+    RecordEvents();
+}
+
+void Table::ApplyStandUp(int seat) {
+    _table.stand_up(seat);
+    Log([&](HandHistoryWriter& log) {
+        log.StandUp(seat);
+        log.EndHandIfOver(_table);
+    });
+    RecordEvents();
+}
+
+void Table::ApplyStartHand(int button) {
+    if (_journal && !_table.hand_in_progress()) {
+        _journal->Reset(_table);
+    }
+
+    // The draws are only recorded, and the deck order worked out from them, when something logs the hand.
+    if (!_history && !_journal) {
+        ApplyCommand(_table, _rng, static_cast<std::int32_t>(Opcode::start_hand), button, 0);
+    } else {
+        auto draw_size = std::size_t{0};
+        _draws.clear();
+        _rng.Visit([&](auto& engine) {
+            using Recorder = RecordingEngine<std::decay_t<decltype(engine)>>;
+            auto recorder = Recorder{engine, _draws};
+            ApplyCommand(_table, recorder, static_cast<std::int32_t>(Opcode::start_hand), button, 0);
+            draw_size = Recorder::draw_size;
+        });
+        const auto deck = ShuffledDeck(draw_size, _draws);
+        Log([&](HandHistoryWriter& log) {
+            log.StartHand(_table, deck);
+        });
+    }
+    RecordEvents();
+    POKER_METRICS_HAND_STARTED();
+}
+
+void Table::ApplyAction(const Decision& decision) {
+    const auto seat = _table.player_to_act();
+    if (decision.action == poker::action::bet || decision.action == poker::action::raise) {
+        _table.action_taken(decision.action, decision.bet_size);
+    } else {
+        _table.action_taken(decision.action);
+    }
+    Log([&](HandHistoryWriter& log) {
+        log.ActionTaken(seat, decision.action, decision.bet_size);
+        log.EndHandIfOver(_table);
+    });
+    RecordEvents();
+}
+
+void Table::ApplyEndBettingRound() {
+    _table.end_betting_round();
+    Log([&](HandHistoryWriter& log) {
+        log.EndBettingRound();
+        log.CardsDealt(_table);
+        log.EndHandIfOver(_table);
+    });
+    RecordEvents();
+}
+
+void Table::ApplyShowdown() {
     _table.showdown();
+    Log([&](HandHistoryWriter& log) {
+        log.Showdown();
+        log.CardsDealt(_table);
+        log.EndHandIfOver(_table);
+    });
+    RecordEvents();
+}
+
+void Table::SetPolicy(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(set_policy);
+    if (info.Length() != 2 || !info[0].IsNumber()) {
+        throw Napi::TypeError::New(info.Env(), "Expected 2 arguments: (seat, policy)");
+    }
+    const auto seat = info[0].As<Napi::Number>().Int32Value();
+    if (seat < 0 || seat >= static_cast<std::int32_t>(poker::table::num_seats)) {
+        throw Napi::RangeError::New(info.Env(), "Invalid seat index");
+    }
+    if (info[1].IsNull() || info[1].IsUndefined()) {
+        _policies[seat].reset();
+    } else {
+        _policies[seat] = ToPolicy(info.Env(), info[1]);
+    }
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Table::Advance(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(advance);
+    auto num_actions = 0;
+    while (_table.hand_in_progress()) {
+        if (_table.betting_round_in_progress()) {
+            const auto& policy = _policies[_table.player_to_act()];
+            if (!policy) {
+                break;
+            }
+            if (!_policy_rng) {
+                _policy_rng.emplace(RandomSeed());
+            }
+            ApplyAction(Decide(*policy, _table, *_policy_rng));
+            ++num_actions;
+        } else if (_table.betting_rounds_completed()) {
+            ApplyShowdown();
+        } else {
+            ApplyEndBettingRound();
+        }
+    }
+    return Napi::Number::New(info.Env(), num_actions);
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Table::ApplyBatch(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(apply_batch);
+    auto env = info.Env();
+    if (info.Length() < 1 || !info[0].IsTypedArray()
+        || info[0].As<Napi::TypedArray>().TypedArrayType() != napi_int32_array) {
+        throw Napi::TypeError::New(env, "Expected an Int32Array of commands");
+    }
+    auto commands = info[0].As<Napi::Int32Array>();
+    if (commands.ElementLength() % batch_command_size != 0) {
+        throw Napi::RangeError::New(env, "Commands length must be a multiple of 3");
+    }
+    auto snapshot = Napi::Int32Array{};
+    if (info.Length() > 1) {
+        if (!info[1].IsTypedArray() || info[1].As<Napi::TypedArray>().TypedArrayType() != napi_int32_array
+            || info[1].As<Napi::Int32Array>().ElementLength() < snapshot::size) {
+            throw Napi::TypeError::New(env, "Expected an Int32Array of at least SNAPSHOT_SIZE elements");
+        }
+        snapshot = info[1].As<Napi::Int32Array>();
+    }
+
+    auto failed = std::int32_t{-1};
+    _batch_error.clear();
+    const auto count = commands.ElementLength() / batch_command_size;
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto opcode = commands[i * batch_command_size];
+        const auto arg0 = commands[i * batch_command_size + 1];
+        const auto arg1 = commands[i * batch_command_size + 2];
+        try {
+            switch (static_cast<Opcode>(opcode)) {
+            case Opcode::sit_down:          ApplySitDown(arg0, arg1); break;
+            case Opcode::stand_up:          ApplyStandUp(arg0); break;
+            case Opcode::start_hand:        ApplyStartHand(arg0); break;
+            case Opcode::end_betting_round: ApplyEndBettingRound(); break;
+            case Opcode::showdown:          ApplyShowdown(); break;
+            case Opcode::action_taken: {
+                const auto action = ToAction(arg0);
+                const auto sized = action == poker::action::bet || action == poker::action::raise;
+                ApplyAction({action, sized ? arg1 : 0});
+                break;
+            }
+            default:
+                throw std::invalid_argument{"Invalid command opcode"};
+            }
+            // Deal the next round of betting or run the showdown once nobody is left to act.
+            while (_table.hand_in_progress() && !_table.betting_round_in_progress()) {
+                if (_table.betting_rounds_completed()) {
+                    ApplyShowdown();
+                } else {
+                    ApplyEndBettingRound();
+                }
+            }
+        } catch (const std::exception& e) {
+            failed = static_cast<std::int32_t>(i);
+            _batch_error = e.what();
+            break;
+        }
+    }
+
+    if (!snapshot.IsEmpty()) {
+        WriteSnapshot(_table, snapshot.Data());
+    }
+    return Napi::Number::New(env, failed);
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Table::GetBatchError(const Napi::CallbackInfo& info) try {
+    return Napi::String::New(info.Env(), _batch_error);
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
 
 void Table::SetAutomaticAction(const Napi::CallbackInfo& info) try {
-    static const std::string actions[] = {
-        "fold", "check/fold", "check", "call", "call any", "all in"
-    };
-    if (info.Length() != 2 || !info[0].IsNumber() || !info[1].IsString()) {
+    POKER_METRICS_SCOPE(set_automatic_action);
+    if (info.Length() != 2 || !info[0].IsNumber() || !(info[1].IsNumber() || info[1].IsString())) {
         Napi::TypeError::New(info.Env(), "Invalid arguments").ThrowAsJavaScriptException();
     }
 
@@ -467,17 +922,255 @@ void Table::SetAutomaticAction(const Napi::CallbackInfo& info) try {
     }
 
     using automatic_action = poker::table::automatic_action;
-    auto action = info[0].As<Napi::String>().Utf8Value();
     auto aa = automatic_action{};
-    if (action == actions[0]) aa = automatic_action::fold;
-    else if (action == actions[1]) aa = automatic_action::check_fold;
-    else if (action == actions[2]) aa = automatic_action::check;
-    else if (action == actions[3]) aa = automatic_action::call;
-    else if (action == actions[4]) aa = automatic_action::call_any;
-    else if (action == actions[5]) aa = automatic_action::all_in;
-    else Napi::TypeError::New(info.Env(), "Invalid action").ThrowAsJavaScriptException();
+    if (info[1].IsNumber()) {
+        aa = ToAutomaticAction(info[1].As<Napi::Number>().Int32Value());
+    } else {
+        char buffer[16];
+        const auto action = ToStringView(info[1], buffer);
+        if (action == "fold") aa = automatic_action::fold;
+        else if (action == "check/fold") aa = automatic_action::check_fold;
+        else if (action == "check") aa = automatic_action::check;
+        else if (action == "call") aa = automatic_action::call;
+        else if (action == "call any") aa = automatic_action::call_any;
+        else if (action == "all in") aa = automatic_action::all_in;
+        else throw Napi::TypeError::New(info.Env(), "Invalid action");
+    }
 
     _table.set_automatic_action(seat, aa);
+    Log([&](HandHistoryWriter& log) {
+        log.SetAutomaticAction(seat, aa);
+    });
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+void Table::EnableEvents(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(enable_events);
+    if (info.Length() != 1 || !info[0].IsNumber()) {
+        throw Napi::TypeError::New(info.Env(), "Expected 1 argument of type Number");
+    }
+    const auto capacity = info[0].As<Napi::Number>().Int64Value();
+    if (capacity < 0) {
+        throw Napi::RangeError::New(info.Env(), "Invalid capacity");
+    }
+    if (capacity == 0) {
+        _events.reset();
+    } else {
+        _events = std::make_unique<EventLog>(_table, static_cast<std::size_t>(capacity));
+    }
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Table::DrainEvents(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(drain_events);
+    if (info.Length() != 1 || !info[0].IsTypedArray()
+        || info[0].As<Napi::TypedArray>().TypedArrayType() != napi_int32_array) {
+        throw Napi::TypeError::New(info.Env(), "Expected 1 argument of type Int32Array");
+    }
+    if (!_events) {
+        return Napi::Number::New(info.Env(), 0);
+    }
+    auto buffer = info[0].As<Napi::Int32Array>();
+    const auto count = _events->Drain(buffer.Data(), buffer.ElementLength() / EventLog::record_size);
+    return Napi::Number::New(info.Env(), static_cast<double>(count));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+void Table::RecordEvents() {
+    if (_events) {
+        _events->Record(_table);
+    }
+}
+
+void Table::RecordHistory(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(record_history);
+    if (info.Length() == 0 || info[0].IsNull() || info[0].IsUndefined()) {
+        _history.reset();
+        return;
+    }
+    if (!info[0].IsString()) {
+        throw Napi::TypeError::New(info.Env(), "Expected 1 argument of type String");
+    }
+    _history.reset();
+    _history = std::make_unique<HandHistoryWriter>(info[0].As<Napi::String>().Utf8Value(), _table);
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+void Table::FlushHistory(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(flush_history);
+    Log([&](HandHistoryWriter& log) {
+        log.Flush();
+    });
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+std::vector<std::uint8_t> Table::Journal() const {
+    if (_table.hand_in_progress()) {
+        if (!_journal) {
+            throw std::logic_error("A table created with journal: false cannot save a hand in progress");
+        }
+        return _journal->buffer();
+    }
+    return HandHistoryWriter{_table}.buffer();
+}
+
+Napi::Value Table::Serialize(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(serialize);
+    auto env = info.Env();
+    const auto journal = Journal();
+    if (info.Length() == 0) {
+        auto buffer = Napi::ArrayBuffer::New(env, journal.size());
+        std::memcpy(buffer.Data(), journal.data(), journal.size());
+        return buffer;
+    }
+
+    // Writing into a view of a SharedArrayBuffer lets another worker deserialize the table without a copy
+    // through postMessage.
+    if (info.Length() != 1 || !info[0].IsTypedArray()
+        || info[0].As<Napi::TypedArray>().TypedArrayType() != napi_uint8_array) {
+        throw Napi::TypeError::New(env, "Expected an optional Uint8Array");
+    }
+    auto buffer = info[0].As<Napi::Uint8Array>();
+    if (buffer.ByteLength() < journal.size()) {
+        throw Napi::RangeError::New(env, "Buffer too small for the serialized table");
+    }
+    std::memcpy(buffer.Data(), journal.data(), journal.size());
+    return Napi::Number::New(env, static_cast<double>(journal.size()));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Table::Fork(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(fork);
+    const auto journal = Journal();
+    auto result = ReplayResult{};
+    auto options = Napi::Object::New(info.Env());
+    options.Set("journal", Napi::Boolean::New(info.Env(), _journal != nullptr));
+    auto object = FromHistory(info.Env(), journal.data(), journal.size(), options, result);
+    auto table = Table::Unwrap(object);
+    table->_rng = Rng{_rng.kind()};
+    table->_policies = _policies;
+    return object;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Table::Explore(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(explore);
+    auto env = info.Env();
+    if (info.Length() < 2 || !info[0].IsNumber() || !info[1].IsArray()
+        || (info.Length() == 3 && !info[2].IsNumber())) {
+        throw Napi::TypeError::New(env, "Expected arguments (depth, actionSet[, maxNodes])");
+    }
+    const auto depth = info[0].As<Napi::Number>().Int32Value();
+    auto action_set = info[1].As<Napi::Array>();
+    auto candidates = std::vector<CandidateAction>{};
+    for (std::uint32_t i = 0; i < action_set.Length(); ++i) {
+        const auto value = action_set.Get(i);
+        auto candidate = CandidateAction{};
+        if (value.IsNumber()) {
+            candidate.kind = CandidateAction::Kind::size;
+            candidate.size = value.As<Napi::Number>().Int32Value();
+        } else {
+            const auto name = value.IsString() ? value.As<Napi::String>().Utf8Value() : std::string{};
+            if (name == "fold") candidate.kind = CandidateAction::Kind::fold;
+            else if (name == "check") candidate.kind = CandidateAction::Kind::check;
+            else if (name == "call") candidate.kind = CandidateAction::Kind::call;
+            else if (name == "minRaise") candidate.kind = CandidateAction::Kind::min_raise;
+            else if (name == "allIn") candidate.kind = CandidateAction::Kind::all_in;
+            else throw Napi::TypeError::New(env, "Invalid action in actionSet");
+        }
+        candidates.push_back(candidate);
+    }
+    const auto max_nodes = info.Length() == 3 ? info[2].As<Napi::Number>().Int64Value() : 100000;
+    if (max_nodes < 0) {
+        throw Napi::RangeError::New(env, "maxNodes must be non-negative");
+    }
+
+    const auto result = ::Explore(Journal(), depth, candidates, static_cast<std::size_t>(max_nodes));
+    const auto copy = [&](const std::vector<std::int32_t>& values) {
+        auto array = Napi::Int32Array::New(env, values.size());
+        std::copy(values.begin(), values.end(), array.Data());
+        return array;
+    };
+    auto obj = Napi::Object::New(env);
+    obj.Set("parents", copy(result.parents));
+    obj.Set("actions", copy(result.actions));
+    obj.Set("states", copy(result.states));
+    return obj;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Object Table::FromHistory(Napi::Env env, const std::uint8_t* data, std::size_t size,
+                                Napi::Object options, ReplayResult& result) {
+    const auto forced_bets = HandHistoryForcedBets(data, size);
+    options.Set("ante", Napi::Number::New(env, forced_bets.ante));
+    options.Set("smallBlind", Napi::Number::New(env, forced_bets.blinds.small));
+    options.Set("bigBlind", Napi::Number::New(env, forced_bets.blinds.big));
+    auto object = GetAddonData(env).table_constructor.New({ options });
+    auto table = Table::Unwrap(object);
+
+    result = ReplayHandHistory(data, size, table->_table);
+    if (table->_journal && table->_table.hand_in_progress()) {
+        table->_journal->Restore(table->_table, data, size);
+    }
+    return object;
+}
+
+Napi::Value Table::Replay(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(replay);
+    auto env = info.Env();
+    if (info.Length() != 1) {
+        throw Napi::TypeError::New(env, "Expected 1 argument");
+    }
+    const auto bytes = ToBytes(env, info[0]);
+    auto result = ReplayResult{};
+    auto table = FromHistory(env, bytes.first, bytes.second, Napi::Object::New(env), result);
+
+    auto obj = Napi::Object::New(env);
+    obj.Set("hands", Napi::Number::New(env, static_cast<double>(result.hands)));
+    obj.Set("actions", Napi::Number::New(env, static_cast<double>(result.actions)));
+    obj.Set("table", table);
+    return obj;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Table::Deserialize(const Napi::CallbackInfo& info) try {
+    POKER_METRICS_SCOPE(deserialize);
+    auto env = info.Env();
+    if (info.Length() < 1 || info.Length() > 2 || (info.Length() == 2 && !info[1].IsObject())) {
+        throw Napi::TypeError::New(env, "Expected arguments (buffer[, options])");
+    }
+    auto options = Napi::Object::New(env);
+    if (info.Length() == 2) {
+        auto obj = info[1].As<Napi::Object>();
+        if (obj.Has("rng")) options.Set("rng", obj.Get("rng"));
+        if (obj.Has("seed")) options.Set("seed", obj.Get("seed"));
+        if (obj.Has("journal")) options.Set("journal", obj.Get("journal"));
+    }
+    const auto bytes = ToBytes(env, info[0]);
+    auto result = ReplayResult{};
+    return FromHistory(env, bytes.first, bytes.second, options, result);
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Table::GetMetrics(const Napi::CallbackInfo& info) try {
+    if (info.Length() > 1 || (info.Length() == 1 && (!info[0].IsTypedArray()
+        || info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array
+        || info[0].As<Napi::Float64Array>().ElementLength() < metrics::size))) {
+        throw Napi::TypeError::New(info.Env(), "Expected an optional Float64Array with at least METRICS_SIZE elements");
+    }
+    auto buffer = info.Length() == 1 ? info[0].As<Napi::Float64Array>() : Napi::Float64Array::New(info.Env(), metrics::size);
+    metrics::Write(buffer.Data());
+    return buffer;
 } catch (const std::exception& e) {
     throw Napi::Error::New(info.Env(), e.what());
 }
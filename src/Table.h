@@ -3,15 +3,36 @@
 
 #include <napi.h>
 
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
 #define POKER_THROW_ON_ERROR
 #include "poker/table.hpp"
 
+#include "EventLog.h"
+#include "HandHistory.h"
+#include "Policy.h"
+#include "Rng.h"
+
 class Table : public Napi::ObjectWrap<Table> {
 public:
     static Napi::Object Init(Napi::Env env, Napi::Object exports);
     Table(const Napi::CallbackInfo& info);
 
-    static Napi::FunctionReference constructor;
+    // Commands of applyBatch are [opcode, arg0, arg1] (see Command.h).
+    static constexpr std::size_t batch_command_size = 3;
+
+    // Re-drives a fresh table through a binary hand history.
+    static Napi::Value Replay(const Napi::CallbackInfo& info);
+
+    // Restores a table written by serialize.
+    static Napi::Value Deserialize(const Napi::CallbackInfo& info);
+
+    // Writes the metrics of all tables (see Metrics.h) into a Float64Array.
+    static Napi::Value GetMetrics(const Napi::CallbackInfo& info);
 
 private:
     // Observers
@@ -28,10 +49,17 @@ private:
     Napi::Value GetRoundOfBetting(const Napi::CallbackInfo& info);
     Napi::Value GetCommunityCards(const Napi::CallbackInfo& info);
     Napi::Value GetLegalActions(const Napi::CallbackInfo& info);
+    Napi::Value GetLegalMask(const Napi::CallbackInfo& info);
     Napi::Value GetAutomaticActions(const Napi::CallbackInfo& info);
     Napi::Value CanSetAutomaticAction(const Napi::CallbackInfo& info);
     Napi::Value GetLegalAutomaticActions(const Napi::CallbackInfo& info);
     Napi::Value GetHoleCards(const Napi::CallbackInfo& info);
+    Napi::Value GetHoleCardSets(const Napi::CallbackInfo& info);
+    Napi::Value GetCommunityCardSet(const Napi::CallbackInfo& info);
+    Napi::Value Snapshot(const Napi::CallbackInfo& info);
+    Napi::Value Serialize(const Napi::CallbackInfo& info);
+    Napi::Value Fork(const Napi::CallbackInfo& info);
+    Napi::Value Explore(const Napi::CallbackInfo& info);
 
     // Modifiers
     void SetForcedBets(const Napi::CallbackInfo& info);
@@ -39,11 +67,55 @@ private:
     void StandUp(const Napi::CallbackInfo& info);
     void StartHand(const Napi::CallbackInfo& info);
     void ActionTaken(const Napi::CallbackInfo& info);
+    Napi::Value TryAction(const Napi::CallbackInfo& info);
     void EndBettingRound(const Napi::CallbackInfo& info);
     void Showdown(const Napi::CallbackInfo& info);
     void SetAutomaticAction(const Napi::CallbackInfo& info);
+    void EnableEvents(const Napi::CallbackInfo& info);
+    Napi::Value DrainEvents(const Napi::CallbackInfo& info);
+    void RecordHistory(const Napi::CallbackInfo& info);
+    void FlushHistory(const Napi::CallbackInfo& info);
+    void SetPolicy(const Napi::CallbackInfo& info);
+    Napi::Value Advance(const Napi::CallbackInfo& info);
+    Napi::Value ApplyBatch(const Napi::CallbackInfo& info);
+    Napi::Value GetBatchError(const Napi::CallbackInfo& info);
+
+    // Apply a step of the hand, logging it and recording its events.
+    void ApplySitDown(int seat, int buy_in);
+    void ApplyStandUp(int seat);
+    void ApplyStartHand(int button);
+    void ApplyAction(const Decision& decision);
+    void ApplyEndBettingRound();
+    void ApplyShowdown();
+
+    void RecordEvents();
+
+    // Passes the history being recorded and the journal of the current hand to write.
+    template<class F>
+    void Log(F&& write);
+
+    // Returns a hand history which recreates the current state of the table.
+    std::vector<std::uint8_t> Journal() const;
+
+    // Creates a table from a hand history, passing options on to the constructor.
+    static Napi::Object FromHistory(Napi::Env env, const std::uint8_t* data, std::size_t size,
+                                    Napi::Object options, ReplayResult& result);
 
     poker::table _table;
+    Rng _rng;
+    std::unique_ptr<EventLog> _events;
+    std::unique_ptr<HandHistoryWriter> _history;
+    // Keeps the hand in progress so that it can be serialized, unless the table was created with journal: false.
+    std::unique_ptr<HandHistoryWriter> _journal;
+    std::vector<std::uint64_t> _draws;
+
+    // Seats played natively by advance, and the generator of their random choices (seeded on first use
+    // unless the table was given a seed).
+    std::array<std::optional<Policy>, poker::table::num_seats> _policies;
+    std::optional<Xoshiro256> _policy_rng;
+
+    // Message of the command which failed in the last applyBatch.
+    std::string _batch_error;
 };
 
 #endif // TABLE_H
@@ -0,0 +1,184 @@
+#include "TableSet.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+#include "Snapshot.h"
+
+namespace {
+
+void WriteResult(std::int32_t* result, const poker::table& table, std::int32_t status) {
+    auto flags = std::int32_t{0};
+    auto player_to_act = std::int32_t{-1};
+    auto button = std::int32_t{-1};
+    if (table.hand_in_progress()) {
+        flags |= snapshot::hand_in_progress;
+        button = table.button();
+        if (table.betting_round_in_progress()) {
+            flags |= snapshot::betting_round_in_progress;
+            player_to_act = table.player_to_act();
+        }
+        if (table.betting_rounds_completed()) {
+            flags |= snapshot::betting_rounds_completed;
+        }
+    }
+    result[0] = status;
+    result[1] = flags;
+    result[2] = player_to_act;
+    result[3] = button;
+}
+
+} // namespace
+
+Napi::Object TableSet::Init(Napi::Env env, Napi::Object exports) {
+    Napi::HandleScope scope(env);
+
+    Napi::Function func = DefineClass(env, "TableSet", {
+        InstanceMethod("size", &TableSet::GetSize),
+        InstanceMethod("errorMessage", &TableSet::GetErrorMessage),
+
+        InstanceMethod("apply", &TableSet::Apply)
+        });
+
+    auto command = Napi::Object::New(env);
+    command.Set("SIT_DOWN", static_cast<int32_t>(Opcode::sit_down));
+    command.Set("STAND_UP", static_cast<int32_t>(Opcode::stand_up));
+    command.Set("START_HAND", static_cast<int32_t>(Opcode::start_hand));
+    command.Set("ACTION_TAKEN", static_cast<int32_t>(Opcode::action_taken));
+    command.Set("END_BETTING_ROUND", static_cast<int32_t>(Opcode::end_betting_round));
+    command.Set("SHOWDOWN", static_cast<int32_t>(Opcode::showdown));
+
+    exports.Set("TableSet", func);
+    exports.Set("Command", command);
+    return exports;
+}
+
+TableSet::TableSet(const Napi::CallbackInfo& info) try
+    : Napi::ObjectWrap<TableSet>(info)
+{
+    Napi::Env env = info.Env();
+    Napi::HandleScope scope(env);
+
+    if (info.Length() != 1 || !info[0].IsObject()) {
+        throw Napi::TypeError::New(env, "Expected 1 argument");
+    }
+    auto obj = info[0].As<Napi::Object>();
+    if (!obj.Get("size").IsNumber() || !obj.Get("forcedBets").IsObject()) {
+        throw Napi::TypeError::New(env, "Expected size and forcedBets");
+    }
+    const auto size = obj.Get("size").As<Napi::Number>().Int64Value();
+    if (size < 1) {
+        throw Napi::RangeError::New(env, "size must be positive");
+    }
+    auto forced_bets = obj.Get("forcedBets").As<Napi::Object>();
+    const auto ante = forced_bets.Get("ante").As<Napi::Number>();
+    const auto small_blind = forced_bets.Get("smallBlind").As<Napi::Number>();
+    const auto big_blind = forced_bets.Get("bigBlind").As<Napi::Number>();
+    auto num_threads = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    if (obj.Get("threads").IsNumber()) {
+        num_threads = static_cast<unsigned>(std::max(0, obj.Get("threads").As<Napi::Number>().Int32Value()));
+    }
+
+    _size = static_cast<std::size_t>(size);
+    // Reserved up front, so each table is constructed once in place and never moved.
+    _tables.reserve(_size);
+    for (std::size_t i = 0; i < _size; ++i) {
+        _tables.emplace_back(poker::forced_bets{poker::blinds{small_blind, big_blind}, ante});
+    }
+    const auto kind = obj.Get("rng").IsString()
+        ? Rng::ParseKind(obj.Get("rng").As<Napi::String>().Utf8Value())
+        : Rng::Kind::xoshiro256;
+    auto seeds = SplitMix64{obj.Get("seed").IsNumber()
+        ? static_cast<std::uint64_t>(obj.Get("seed").As<Napi::Number>().Int64Value())
+        : RandomSeed()};
+    _rngs.reserve(_size);
+    for (std::size_t i = 0; i < _size; ++i) {
+        _rngs.emplace_back(kind, seeds());
+    }
+    _errors.resize(_size);
+    _pool = std::make_unique<ThreadPool>(num_threads);
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value TableSet::GetSize(const Napi::CallbackInfo& info) try {
+    return Napi::Number::New(info.Env(), static_cast<double>(_size));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value TableSet::GetErrorMessage(const Napi::CallbackInfo& info) try {
+    if (info.Length() != 1 || !info[0].IsNumber()) {
+        throw Napi::TypeError::New(info.Env(), "Expected 1 argument of type Number");
+    }
+    const auto index = info[0].As<Napi::Number>().Int64Value();
+    if (index < 0 || static_cast<std::size_t>(index) >= _size) {
+        throw Napi::RangeError::New(info.Env(), "Invalid table index");
+    }
+    return Napi::String::New(info.Env(), _errors[index]);
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value TableSet::Apply(const Napi::CallbackInfo& info) try {
+    auto env = info.Env();
+    if (info.Length() < 1 || !info[0].IsTypedArray()
+        || info[0].As<Napi::TypedArray>().TypedArrayType() != napi_int32_array) {
+        throw Napi::TypeError::New(env, "Expected an Int32Array of commands");
+    }
+    auto commands = info[0].As<Napi::Int32Array>();
+    if (commands.ElementLength() % command_size != 0) {
+        throw Napi::RangeError::New(env, "Commands length must be a multiple of 4");
+    }
+
+    auto results = Napi::Int32Array{};
+    if (info.Length() > 1) {
+        if (!info[1].IsTypedArray() || info[1].As<Napi::TypedArray>().TypedArrayType() != napi_int32_array
+            || info[1].As<Napi::Int32Array>().ElementLength() < _size * result_size) {
+            throw Napi::TypeError::New(env, "Expected an Int32Array of results with 4 elements per table");
+        }
+        results = info[1].As<Napi::Int32Array>();
+    } else {
+        results = Napi::Int32Array::New(env, _size * result_size);
+    }
+
+    // Bucket the commands by table, preserving their order within each table.
+    const auto* data = commands.Data();
+    const auto num_commands = commands.ElementLength() / command_size;
+    _offsets.assign(_size + 1, 0);
+    for (std::size_t c = 0; c < num_commands; ++c) {
+        const auto table_index = data[c * command_size];
+        if (table_index < 0 || static_cast<std::size_t>(table_index) >= _size) {
+            throw Napi::RangeError::New(env, "Invalid table index in command " + std::to_string(c));
+        }
+        ++_offsets[table_index + 1];
+    }
+    for (std::size_t t = 0; t < _size; ++t) {
+        _offsets[t + 1] += _offsets[t];
+    }
+    _cursors.assign(_offsets.begin(), _offsets.end() - 1);
+    _order.resize(num_commands);
+    for (std::size_t c = 0; c < num_commands; ++c) {
+        _order[_cursors[data[c * command_size]]++] = static_cast<std::uint32_t>(c);
+    }
+
+    auto* out = results.Data();
+    _pool->ParallelFor(_size, [&](std::size_t t) {
+        auto status = std::int32_t{-1};
+        for (auto k = _offsets[t]; k < _offsets[t + 1]; ++k) {
+            const auto* command = data + _order[k] * command_size;
+            try {
+                ApplyCommand(_tables[t], _rngs[t], command[1], command[2], command[3]);
+            } catch (const std::exception& e) {
+                status = static_cast<std::int32_t>(_order[k]);
+                _errors[t] = e.what();
+                break;
+            }
+        }
+        WriteResult(out + t * result_size, _tables[t], status);
+    });
+    return results;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
@@ -0,0 +1,49 @@
+#ifndef TABLE_SET_H
+#define TABLE_SET_H
+
+#include <napi.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Command.h"
+#include "Rng.h"
+#include "ThreadPool.h"
+
+// Owns a contiguous pool of tables that are driven by batches of packed commands. The commands of each
+// table are applied in order; different tables are processed concurrently on a work-stealing thread pool.
+class TableSet : public Napi::ObjectWrap<TableSet> {
+public:
+    static Napi::Object Init(Napi::Env env, Napi::Object exports);
+    TableSet(const Napi::CallbackInfo& info);
+
+    // Commands are [table index, opcode, arg0, arg1].
+    static constexpr std::size_t command_size = 4;
+
+    // Results are [status, flags, player to act, button] per table. Status is the index of the first failed
+    // command of that table in the batch, or -1.
+    static constexpr std::size_t result_size = 4;
+
+private:
+    // Observers
+    Napi::Value GetSize(const Napi::CallbackInfo& info);
+    Napi::Value GetErrorMessage(const Napi::CallbackInfo& info);
+
+    // Modifiers
+    Napi::Value Apply(const Napi::CallbackInfo& info);
+
+    std::size_t _size = 0;
+    std::vector<poker::table> _tables;
+    std::vector<Rng> _rngs;
+    std::vector<std::string> _errors;
+    std::unique_ptr<ThreadPool> _pool;
+
+    // Scratch space for bucketing the commands of a batch by table.
+    std::vector<std::uint32_t> _offsets;
+    std::vector<std::uint32_t> _cursors;
+    std::vector<std::uint32_t> _order;
+};
+
+#endif // TABLE_SET_H
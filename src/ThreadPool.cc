@@ -0,0 +1,127 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <exception>
+
+ThreadPool::ThreadPool(unsigned num_threads) {
+    // The last queue belongs to the threads calling ParallelFor.
+    for (unsigned i = 0; i <= num_threads; ++i) {
+        _queues.push_back(std::make_unique<Queue>());
+    }
+    _threads.reserve(num_threads);
+    for (unsigned i = 0; i < num_threads; ++i) {
+        _threads.emplace_back([this, i] { WorkerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _stop = true;
+    }
+    _cv.notify_all();
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::ParallelFor(std::size_t count, const std::function<void(std::size_t)>& fn) {
+    if (count == 0) {
+        return;
+    }
+
+    // Split the range into a few chunks per queue so that stealing can even out uneven work.
+    const auto num_chunks = std::min(count, _queues.size() * 4);
+    std::atomic<std::size_t> remaining{num_chunks};
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    std::exception_ptr error;
+
+    for (std::size_t c = 0; c < num_chunks; ++c) {
+        const auto begin = count * c / num_chunks;
+        const auto end = count * (c + 1) / num_chunks;
+        Push(c % _queues.size(), [&, begin, end] {
+            try {
+                for (auto i = begin; i < end; ++i) {
+                    fn(i);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{done_mutex};
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+            // Decrement under the lock so that the waiting caller cannot return before we are done with it.
+            std::lock_guard<std::mutex> lock{done_mutex};
+            if (--remaining == 0) {
+                done_cv.notify_all();
+            }
+        });
+    }
+
+    // Help out until there is nothing left to take, then wait for the chunks still running.
+    const auto self = _queues.size() - 1;
+    auto task = Task{};
+    while (remaining.load() > 0 && (TryPop(self, task) || TrySteal(self, task))) {
+        task();
+    }
+    std::unique_lock<std::mutex> lock{done_mutex};
+    done_cv.wait(lock, [&] { return remaining.load() == 0; });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::Push(std::size_t queue_index, Task task) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        ++_num_queued;
+    }
+    {
+        auto& queue = *_queues[queue_index];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        queue.tasks.push_back(std::move(task));
+    }
+    _cv.notify_one();
+}
+
+bool ThreadPool::TryPop(std::size_t queue_index, Task& task) {
+    auto& queue = *_queues[queue_index];
+    std::lock_guard<std::mutex> lock{queue.mutex};
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    --_num_queued;
+    return true;
+}
+
+bool ThreadPool::TrySteal(std::size_t thief_index, Task& task) {
+    for (std::size_t k = 1; k < _queues.size(); ++k) {
+        auto& queue = *_queues[(thief_index + k) % _queues.size()];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            --_num_queued;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::WorkerLoop(std::size_t index) {
+    for (;;) {
+        auto task = Task{};
+        if (TryPop(index, task) || TrySteal(index, task)) {
+            task();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock{_mutex};
+        _cv.wait(lock, [this] { return _stop || _num_queued.load() > 0; });
+        if (_stop && _num_queued.load() == 0) {
+            return;
+        }
+    }
+}
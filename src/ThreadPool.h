@@ -0,0 +1,51 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A work-stealing thread pool. Every worker owns a task queue; idle workers steal from the front of the
+// other queues. The thread calling ParallelFor takes part in the work while it waits.
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned num_threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const noexcept { return static_cast<unsigned>(_threads.size()); }
+
+    // Calls fn(i) for every i in [0, count) and blocks until all calls have returned. The first exception
+    // thrown by fn is rethrown once every call has finished.
+    void ParallelFor(std::size_t count, const std::function<void(std::size_t)>& fn);
+
+private:
+    using Task = std::function<void()>;
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void Push(std::size_t queue_index, Task task);
+    bool TryPop(std::size_t queue_index, Task& task);
+    bool TrySteal(std::size_t thief_index, Task& task);
+    void WorkerLoop(std::size_t index);
+
+    std::vector<std::unique_ptr<Queue>> _queues;
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::atomic<std::size_t> _num_queued{0};
+    bool _stop = false;
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,212 @@
+#include "Tournament.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "Conversions.h"
+#include "Rng.h"
+
+namespace {
+
+BlindLevel ToBlindLevel(Napi::Env env, Napi::Value value) {
+    if (!value.IsObject()) {
+        throw Napi::TypeError::New(env, "Expected blind levels of type Object");
+    }
+    auto obj = value.As<Napi::Object>();
+    if (!obj.Get("smallBlind").IsNumber() || !obj.Get("bigBlind").IsNumber()) {
+        throw Napi::TypeError::New(env, "Expected blind levels with smallBlind and bigBlind");
+    }
+    auto level = BlindLevel{};
+    level.ante = obj.Get("ante").IsNumber() ? obj.Get("ante").As<Napi::Number>().Int32Value() : 0;
+    level.small_blind = obj.Get("smallBlind").As<Napi::Number>().Int32Value();
+    level.big_blind = obj.Get("bigBlind").As<Napi::Number>().Int32Value();
+    if (obj.Get("hands").IsNumber()) {
+        level.hands = static_cast<std::uint64_t>(std::max<std::int64_t>(0, obj.Get("hands").As<Napi::Number>().Int64Value()));
+    }
+    if (obj.Get("seconds").IsNumber()) {
+        level.seconds = obj.Get("seconds").As<Napi::Number>().DoubleValue();
+    }
+    return level;
+}
+
+Napi::Int32Array ToInt32Array(Napi::Env env, const std::vector<std::int32_t>& values) {
+    auto array = Napi::Int32Array::New(env, values.size());
+    std::copy(values.begin(), values.end(), array.Data());
+    return array;
+}
+
+} // namespace
+
+Napi::Object Tournament::Init(Napi::Env env, Napi::Object exports) {
+    Napi::HandleScope scope(env);
+
+    Napi::Function func = DefineClass(env, "Tournament", {
+        InstanceMethod("isFinished", &Tournament::IsFinished),
+        InstanceMethod("level", &Tournament::GetLevel),
+        InstanceMethod("rounds", &Tournament::GetRounds),
+        InstanceMethod("numRemaining", &Tournament::GetNumRemaining),
+        InstanceMethod("numTables", &Tournament::GetNumTables),
+        InstanceMethod("eliminations", &Tournament::GetEliminations),
+        InstanceMethod("seating", &Tournament::GetSeating),
+        InstanceMethod("places", &Tournament::GetPlaces),
+        InstanceMethod("stacks", &Tournament::GetStacks),
+        InstanceMethod("payouts", &Tournament::GetPayouts),
+
+        InstanceMethod("play", &Tournament::Play),
+        InstanceMethod("tick", &Tournament::Tick)
+        });
+
+    exports.Set("Tournament", func);
+    return exports;
+}
+
+Tournament::Tournament(const Napi::CallbackInfo& info) try
+    : Napi::ObjectWrap<Tournament>(info)
+{
+    Napi::Env env = info.Env();
+    Napi::HandleScope scope(env);
+
+    if (info.Length() != 1 || !info[0].IsObject()) {
+        throw Napi::TypeError::New(env, "Expected 1 argument");
+    }
+    auto obj = info[0].As<Napi::Object>();
+    if (!obj.Get("entrants").IsNumber() || !obj.Get("stack").IsNumber() || !obj.Get("levels").IsArray()) {
+        throw Napi::TypeError::New(env, "Expected options with entrants, stack and levels");
+    }
+
+    auto config = TournamentConfig{};
+    config.entrants = static_cast<std::size_t>(std::max<std::int64_t>(0, obj.Get("entrants").As<Napi::Number>().Int64Value()));
+    config.stack = obj.Get("stack").As<Napi::Number>().Int32Value();
+    if (obj.Get("seatsPerTable").IsNumber()) {
+        config.seats_per_table = static_cast<std::size_t>(std::max(0, obj.Get("seatsPerTable").As<Napi::Number>().Int32Value()));
+    }
+    auto levels = obj.Get("levels").As<Napi::Array>();
+    for (std::uint32_t i = 0; i < levels.Length(); ++i) {
+        config.levels.push_back(ToBlindLevel(env, levels.Get(i)));
+    }
+    if (obj.Get("payouts").IsArray()) {
+        auto payouts = obj.Get("payouts").As<Napi::Array>();
+        for (std::uint32_t i = 0; i < payouts.Length(); ++i) {
+            if (!payouts.Get(i).IsNumber()) {
+                throw Napi::TypeError::New(env, "Expected payouts of type Number");
+            }
+            config.payouts.push_back(payouts.Get(i).As<Napi::Number>().DoubleValue());
+        }
+    }
+    const auto policy = obj.Get("policy");
+    if (policy.IsArray()) {
+        auto policies = policy.As<Napi::Array>();
+        for (std::uint32_t i = 0; i < policies.Length(); ++i) {
+            config.policies.push_back(ToPolicy(env, policies.Get(i)));
+        }
+    } else if (!policy.IsUndefined()) {
+        config.policies.push_back(ToPolicy(env, policy));
+    }
+
+    const auto seed = obj.Get("seed").IsNumber()
+        ? static_cast<std::uint64_t>(obj.Get("seed").As<Napi::Number>().Int64Value())
+        : RandomSeed();
+    auto num_threads = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    if (obj.Get("threads").IsNumber()) {
+        num_threads = static_cast<unsigned>(std::max(0, obj.Get("threads").As<Napi::Number>().Int32Value()));
+    }
+
+    _engine = std::make_unique<TournamentEngine>(config, seed, num_threads);
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Tournament::IsFinished(const Napi::CallbackInfo& info) try {
+    return Napi::Boolean::New(info.Env(), _engine->finished());
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Tournament::GetLevel(const Napi::CallbackInfo& info) try {
+    return Napi::Number::New(info.Env(), static_cast<double>(_engine->level()));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Tournament::GetRounds(const Napi::CallbackInfo& info) try {
+    return Napi::Number::New(info.Env(), static_cast<double>(_engine->rounds()));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Tournament::GetNumRemaining(const Napi::CallbackInfo& info) try {
+    return Napi::Number::New(info.Env(), static_cast<double>(_engine->num_remaining()));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Tournament::GetNumTables(const Napi::CallbackInfo& info) try {
+    return Napi::Number::New(info.Env(), static_cast<double>(_engine->num_tables()));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Tournament::GetEliminations(const Napi::CallbackInfo& info) try {
+    return ToInt32Array(info.Env(), _engine->eliminations());
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Tournament::GetSeating(const Napi::CallbackInfo& info) try {
+    return ToInt32Array(info.Env(), _engine->seating());
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Tournament::GetPlaces(const Napi::CallbackInfo& info) try {
+    return ToInt32Array(info.Env(), _engine->places());
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Tournament::GetStacks(const Napi::CallbackInfo& info) try {
+    auto stacks = Napi::Float64Array::New(info.Env(), _engine->num_entrants());
+    for (std::size_t i = 0; i < _engine->num_entrants(); ++i) {
+        stacks[i] = _engine->Stack(i);
+    }
+    return stacks;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Tournament::GetPayouts(const Napi::CallbackInfo& info) try {
+    auto payouts = Napi::Float64Array::New(info.Env(), _engine->num_entrants());
+    for (std::size_t i = 0; i < _engine->num_entrants(); ++i) {
+        payouts[i] = _engine->Payout(i);
+    }
+    return payouts;
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+Napi::Value Tournament::Play(const Napi::CallbackInfo& info) try {
+    auto num_rounds = std::int64_t{1};
+    if (info.Length() == 1) {
+        if (!info[0].IsNumber()) {
+            throw Napi::TypeError::New(info.Env(), "Expected 1 argument of type Number");
+        }
+        num_rounds = info[0].As<Napi::Number>().Int64Value();
+        if (num_rounds < 0) {
+            throw Napi::RangeError::New(info.Env(), "numRounds must be non-negative");
+        }
+    }
+    const auto played = _engine->Play(static_cast<std::uint64_t>(num_rounds));
+    return Napi::Number::New(info.Env(), static_cast<double>(played));
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
+
+void Tournament::Tick(const Napi::CallbackInfo& info) try {
+    if (info.Length() != 1 || !info[0].IsNumber()) {
+        throw Napi::TypeError::New(info.Env(), "Expected 1 argument of type Number");
+    }
+    _engine->Tick(info[0].As<Napi::Number>().DoubleValue());
+} catch (const std::exception& e) {
+    throw Napi::Error::New(info.Env(), e.what());
+}
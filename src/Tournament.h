@@ -0,0 +1,37 @@
+#ifndef TOURNAMENT_H
+#define TOURNAMENT_H
+
+#include <napi.h>
+
+#include <memory>
+
+#include "TournamentEngine.h"
+
+// Exposes TournamentEngine as poker.Tournament. Per-entrant results are returned as typed arrays indexed by
+// entrant so that large fields cost no object allocations.
+class Tournament : public Napi::ObjectWrap<Tournament> {
+public:
+    static Napi::Object Init(Napi::Env env, Napi::Object exports);
+    Tournament(const Napi::CallbackInfo& info);
+
+private:
+    // Observers
+    Napi::Value IsFinished(const Napi::CallbackInfo& info);
+    Napi::Value GetLevel(const Napi::CallbackInfo& info);
+    Napi::Value GetRounds(const Napi::CallbackInfo& info);
+    Napi::Value GetNumRemaining(const Napi::CallbackInfo& info);
+    Napi::Value GetNumTables(const Napi::CallbackInfo& info);
+    Napi::Value GetEliminations(const Napi::CallbackInfo& info);
+    Napi::Value GetSeating(const Napi::CallbackInfo& info);
+    Napi::Value GetPlaces(const Napi::CallbackInfo& info);
+    Napi::Value GetStacks(const Napi::CallbackInfo& info);
+    Napi::Value GetPayouts(const Napi::CallbackInfo& info);
+
+    // Modifiers
+    Napi::Value Play(const Napi::CallbackInfo& info);
+    void Tick(const Napi::CallbackInfo& info);
+
+    std::unique_ptr<TournamentEngine> _engine;
+};
+
+#endif // TOURNAMENT_H
@@ -0,0 +1,285 @@
+#include "TournamentEngine.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+namespace {
+
+poker::forced_bets ToForcedBets(const BlindLevel& level) {
+    return poker::forced_bets{poker::blinds{level.small_blind, level.big_blind}, level.ante};
+}
+
+} // namespace
+
+TournamentEngine::TournamentEngine(const TournamentConfig& config, std::uint64_t seed, unsigned num_threads)
+    : _config(config)
+{
+    if (_config.entrants < 2) {
+        throw std::invalid_argument{"A tournament needs at least 2 entrants"};
+    }
+    if (_config.stack <= 0) {
+        throw std::invalid_argument{"Starting stack must be positive"};
+    }
+    if (_config.seats_per_table < 2 || _config.seats_per_table > poker::table::num_seats) {
+        throw std::invalid_argument{"Seats per table must be between 2 and 9"};
+    }
+    if (_config.levels.empty()) {
+        throw std::invalid_argument{"The blind schedule needs at least one level"};
+    }
+    if (_config.policies.empty()) {
+        _config.policies.emplace_back();
+    }
+
+    _num_tables = (_config.entrants + _config.seats_per_table - 1) / _config.seats_per_table;
+    // Reserved up front, so each table is constructed once in place and never moved.
+    _tables.reserve(_num_tables);
+    const auto forced_bets = ToForcedBets(_config.levels.front());
+    for (std::size_t i = 0; i < _num_tables; ++i) {
+        _tables.emplace_back(forced_bets);
+    }
+    _entrants.resize(_num_tables);
+    for (auto& seats : _entrants) {
+        seats.fill(no_seat);
+    }
+    _active.assign(_num_tables, true);
+
+    auto seeds = SplitMix64{seed};
+    _rngs.reserve(_num_tables);
+    for (std::size_t i = 0; i < _num_tables; ++i) {
+        _rngs.emplace_back(seeds());
+    }
+
+    // Draw the seats: entrants are shuffled and dealt around the tables so that their sizes differ by at most 1.
+    auto order = std::vector<std::int32_t>(_config.entrants);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        order[i] = static_cast<std::int32_t>(i);
+    }
+    auto draw = Xoshiro256{seeds()};
+    std::shuffle(order.begin(), order.end(), draw);
+    _seating.assign(_config.entrants, no_seat);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        const auto table = i % _num_tables;
+        const auto seat = i / _num_tables;
+        _tables[table].sit_down(seat, _config.stack);
+        _entrants[table][seat] = order[i];
+        _seating[order[i]] = static_cast<std::int32_t>(table * poker::table::num_seats + seat);
+    }
+
+    _places.assign(_config.entrants, 0);
+    _starting_stacks.assign(_config.entrants, 0);
+    _num_remaining = _config.entrants;
+    _pool = std::make_unique<ThreadPool>(num_threads);
+}
+
+std::uint64_t TournamentEngine::Play(std::uint64_t num_rounds) {
+    auto played = std::uint64_t{0};
+    for (; played < num_rounds && !finished(); ++played) {
+        UpdateLevel();
+        PlayHands();
+        Eliminate();
+        BreakTables();
+        BalanceTables();
+    }
+    return played;
+}
+
+void TournamentEngine::Tick(double seconds) {
+    if (seconds < 0.0) {
+        throw std::invalid_argument{"The clock cannot go backwards"};
+    }
+    _clock_in_level += seconds;
+}
+
+std::size_t TournamentEngine::num_tables() const noexcept {
+    return static_cast<std::size_t>(std::count(_active.begin(), _active.end(), true));
+}
+
+int TournamentEngine::Stack(std::size_t entrant) const {
+    const auto position = _seating.at(entrant);
+    if (position == no_seat) {
+        return 0;
+    }
+    const auto& table = _tables[position / poker::table::num_seats];
+    return static_cast<int>(table.seats()[position % poker::table::num_seats].total_chips());
+}
+
+double TournamentEngine::Payout(std::size_t entrant) const {
+    const auto place = static_cast<std::size_t>(_places.at(entrant));
+    return place != 0 && place <= _config.payouts.size() ? _config.payouts[place - 1] : 0.0;
+}
+
+std::size_t TournamentEngine::NumPlayers(std::size_t table) const {
+    const auto& seats = _entrants[table];
+    return static_cast<std::size_t>(std::count_if(seats.begin(), seats.end(), [](std::int32_t e) { return e != no_seat; }));
+}
+
+void TournamentEngine::PlayHands() {
+    auto tables = std::vector<std::size_t>{};
+    for (std::size_t i = 0; i < _num_tables; ++i) {
+        if (!_active[i] || NumPlayers(i) < 2) {
+            continue;
+        }
+        tables.push_back(i);
+        for (std::size_t seat = 0; seat < poker::table::num_seats; ++seat) {
+            const auto entrant = _entrants[i][seat];
+            if (entrant != no_seat) {
+                _starting_stacks[entrant] = static_cast<int>(_tables[i].seats()[seat].total_chips());
+            }
+        }
+    }
+
+    _pool->ParallelFor(tables.size(), [&](std::size_t n) {
+        const auto i = tables[n];
+        auto& table = _tables[i];
+        const auto policy_of = [&](std::size_t seat) -> const Policy& {
+            return _config.policies[static_cast<std::size_t>(_entrants[i][seat]) % _config.policies.size()];
+        };
+        table.start_hand(_rngs[i]);
+        PlayHand(table, policy_of, _rngs[i]);
+    });
+    ++_hands_in_level;
+    ++_rounds;
+}
+
+void TournamentEngine::Eliminate() {
+    auto busted = std::vector<std::int32_t>{};
+    for (std::size_t i = 0; i < _num_tables; ++i) {
+        if (!_active[i]) {
+            continue;
+        }
+        for (std::size_t seat = 0; seat < poker::table::num_seats; ++seat) {
+            const auto entrant = _entrants[i][seat];
+            if (entrant != no_seat && _tables[i].seats()[seat].total_chips() == 0) {
+                _tables[i].stand_up(seat);
+                _entrants[i][seat] = no_seat;
+                _seating[entrant] = no_seat;
+                busted.push_back(entrant);
+            }
+        }
+    }
+
+    std::sort(busted.begin(), busted.end(), [&](std::int32_t a, std::int32_t b) {
+        return std::tie(_starting_stacks[a], a) < std::tie(_starting_stacks[b], b);
+    });
+    for (const auto entrant : busted) {
+        _places[entrant] = static_cast<std::int32_t>(_num_remaining--);
+        _eliminations.push_back(entrant);
+    }
+    if (_num_remaining == 1) {
+        const auto winner = std::find(_places.begin(), _places.end(), 0);
+        *winner = 1;
+    }
+}
+
+void TournamentEngine::BreakTables() {
+    const auto needed = std::max<std::size_t>(1, (_num_remaining + _config.seats_per_table - 1) / _config.seats_per_table);
+    while (num_tables() > needed) {
+        // Break the smallest table, moving each of its players to the smallest of the others.
+        auto broken = _num_tables;
+        for (std::size_t i = 0; i < _num_tables; ++i) {
+            if (_active[i] && (broken == _num_tables || NumPlayers(i) <= NumPlayers(broken))) {
+                broken = i;
+            }
+        }
+        _active[broken] = false;
+        for (std::size_t seat = 0; seat < poker::table::num_seats; ++seat) {
+            if (_entrants[broken][seat] == no_seat) {
+                continue;
+            }
+            auto destination = _num_tables;
+            for (std::size_t i = 0; i < _num_tables; ++i) {
+                if (_active[i] && (destination == _num_tables || NumPlayers(i) < NumPlayers(destination))) {
+                    destination = i;
+                }
+            }
+            Move(broken, seat, destination);
+        }
+    }
+}
+
+void TournamentEngine::BalanceTables() {
+    for (;;) {
+        auto largest = _num_tables;
+        auto smallest = _num_tables;
+        for (std::size_t i = 0; i < _num_tables; ++i) {
+            if (!_active[i]) {
+                continue;
+            }
+            if (largest == _num_tables || NumPlayers(i) > NumPlayers(largest)) {
+                largest = i;
+            }
+            if (smallest == _num_tables || NumPlayers(i) < NumPlayers(smallest)) {
+                smallest = i;
+            }
+        }
+        if (largest == _num_tables || NumPlayers(largest) <= NumPlayers(smallest) + 1) {
+            return;
+        }
+        Move(largest, NextBigBlind(largest), smallest);
+    }
+}
+
+void TournamentEngine::Move(std::size_t from_table, std::size_t from_seat, std::size_t to_table) {
+    const auto entrant = _entrants[from_table][from_seat];
+    const auto stack = static_cast<int>(_tables[from_table].seats()[from_seat].total_chips());
+    _tables[from_table].stand_up(from_seat);
+    _entrants[from_table][from_seat] = no_seat;
+
+    auto& seats = _entrants[to_table];
+    const auto to_seat = static_cast<std::size_t>(std::find(seats.begin(), seats.begin() + _config.seats_per_table, no_seat)
+                                                  - seats.begin());
+    _tables[to_table].sit_down(to_seat, stack);
+    seats[to_seat] = entrant;
+    _seating[entrant] = static_cast<std::int32_t>(to_table * poker::table::num_seats + to_seat);
+}
+
+// The player who would post the big blind in the next hand, who is the one moved when balancing: the third
+// player after the button, or the button itself heads-up.
+std::size_t TournamentEngine::NextBigBlind(std::size_t table) const {
+    const auto button = static_cast<std::size_t>(_tables[table].button());
+    const auto& seats = _entrants[table];
+    if (NumPlayers(table) < 3 && seats[button] != no_seat) {
+        return button;
+    }
+    auto seen = 0;
+    auto last = button;
+    for (std::size_t i = 1; i <= poker::table::num_seats; ++i) {
+        const auto seat = (button + i) % poker::table::num_seats;
+        if (seats[seat] != no_seat) {
+            last = seat;
+            if (++seen == 3) {
+                break;
+            }
+        }
+    }
+    return last;
+}
+
+void TournamentEngine::UpdateLevel() {
+    const auto previous = _level;
+    while (_level + 1 < _config.levels.size()) {
+        const auto& level = _config.levels[_level];
+        if (level.hands != 0 && _hands_in_level >= level.hands) {
+            _clock_in_level = 0.0;
+        } else if (level.seconds > 0.0 && _clock_in_level >= level.seconds) {
+            _clock_in_level -= level.seconds;
+        } else {
+            break;
+        }
+        _hands_in_level = 0;
+        ++_level;
+    }
+    if (_level != previous) {
+        SetForcedBets();
+    }
+}
+
+void TournamentEngine::SetForcedBets() {
+    const auto forced_bets = ToForcedBets(_config.levels[_level]);
+    for (std::size_t i = 0; i < _num_tables; ++i) {
+        if (_active[i]) {
+            _tables[i].set_forced_bets(forced_bets);
+        }
+    }
+}
@@ -0,0 +1,105 @@
+#ifndef TOURNAMENT_ENGINE_H
+#define TOURNAMENT_ENGINE_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#define POKER_THROW_ON_ERROR
+#include "poker/table.hpp"
+
+#include "Policy.h"
+#include "Rng.h"
+#include "ThreadPool.h"
+
+// A level of the blind schedule. It ends once its tables have played hands hands or the tournament clock has
+// advanced by seconds, whichever comes first; 0 disables a limit. The last level never ends.
+struct BlindLevel {
+    int ante = 0;
+    int small_blind = 0;
+    int big_blind = 0;
+    std::uint64_t hands = 0;
+    double seconds = 0.0;
+};
+
+struct TournamentConfig {
+    std::size_t entrants = 0;
+    int stack = 0;
+    std::size_t seats_per_table = poker::table::num_seats;
+    std::vector<BlindLevel> levels;
+
+    // Prize of each place, first place first. Places past the end are not paid.
+    std::vector<double> payouts;
+
+    // Entrant i is played by policies[i % policies.size()].
+    std::vector<Policy> policies;
+};
+
+// A multi-table tournament played by native policies. Play advances every table by one hand per round on a
+// thread pool, then eliminates the busted players, breaks and balances the tables and moves to the next
+// blind level when it is due. Results are fully determined by the seed.
+class TournamentEngine {
+public:
+    static constexpr std::int32_t no_seat = -1;
+
+    TournamentEngine(const TournamentConfig& config, std::uint64_t seed, unsigned num_threads);
+
+    // Plays up to num_rounds rounds and returns the number played, which is less once the tournament is over.
+    std::uint64_t Play(std::uint64_t num_rounds);
+
+    // Advances the tournament clock. Levels limited by time end before the next round.
+    void Tick(double seconds);
+
+    bool finished() const noexcept { return _num_remaining <= 1; }
+    std::size_t level() const noexcept { return _level; }
+    std::uint64_t rounds() const noexcept { return _rounds; }
+    std::size_t num_remaining() const noexcept { return _num_remaining; }
+    std::size_t num_tables() const noexcept;
+    std::size_t num_entrants() const noexcept { return _seating.size(); }
+
+    // Entrants in the order they were eliminated. Players busted in the same round are ordered by the stack
+    // they started the hand with, smallest first.
+    const std::vector<std::int32_t>& eliminations() const noexcept { return _eliminations; }
+
+    // table index * poker::table::num_seats + seat index of every entrant, or no_seat once eliminated.
+    const std::vector<std::int32_t>& seating() const noexcept { return _seating; }
+
+    // Finishing place of every entrant, 0 while still playing.
+    const std::vector<std::int32_t>& places() const noexcept { return _places; }
+
+    int Stack(std::size_t entrant) const;
+    double Payout(std::size_t entrant) const;
+
+private:
+    std::size_t NumPlayers(std::size_t table) const;
+    void PlayHands();
+    void Eliminate();
+    void BreakTables();
+    void BalanceTables();
+    void Move(std::size_t from_table, std::size_t from_seat, std::size_t to_table);
+    std::size_t NextBigBlind(std::size_t table) const;
+    void UpdateLevel();
+    void SetForcedBets();
+
+    TournamentConfig _config;
+    std::size_t _num_tables;
+    std::vector<poker::table> _tables;
+    std::vector<std::array<std::int32_t, poker::table::num_seats>> _entrants;
+    std::vector<bool> _active;
+    std::vector<Xoshiro256> _rngs;
+    std::unique_ptr<ThreadPool> _pool;
+
+    std::vector<std::int32_t> _seating;
+    std::vector<std::int32_t> _places;
+    std::vector<std::int32_t> _eliminations;
+    std::vector<int> _starting_stacks;
+    std::size_t _num_remaining;
+
+    std::size_t _level = 0;
+    std::uint64_t _hands_in_level = 0;
+    double _clock_in_level = 0.0;
+    std::uint64_t _rounds = 0;
+};
+
+#endif // TOURNAMENT_ENGINE_H
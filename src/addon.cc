@@ -1,9 +1,27 @@
 #include <napi.h>
 
+#include "AddonData.h"
+#include "CardSets.h"
+#include "EquityWorker.h"
+#include "PreflopEquityLookup.h"
+#include "RangeEquityWorker.h"
+#include "SimulateWorker.h"
 #include "Table.h"
+#include "TableSet.h"
+#include "Tournament.h"
 
 Napi::Object InitAll(Napi::Env env, Napi::Object exports) {
+    // Set first: the Init functions below store their references in it.
+    env.SetInstanceData(new AddonData{});
+
     Table::Init(env, exports);
+    TableSet::Init(env, exports);
+    Tournament::Init(env, exports);
+    SimulateWorker::Init(env, exports);
+    CardSets::Init(env, exports);
+    EquityWorker::Init(env, exports);
+    RangeEquityWorker::Init(env, exports);
+    PreflopEquityLookup::Init(env, exports);
 
     return exports;
 }
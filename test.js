@@ -1,4 +1,5 @@
 // const poker = require('bindings')('addon');
+const assert = require('assert')
 const poker = require('./poker')
 
 const t = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 })
@@ -43,5 +44,393 @@ t3.startHand()
 t3.actionTaken('raise', 1000)
 console.log(t3.isBettingRoundInProgress())
 
+const state = new Int32Array(poker.SNAPSHOT_SIZE)
+const decoded = poker.decodeSnapshot(t3.snapshot(state))
+assert(decoded.handInProgress && decoded.seats[0] !== null && decoded.seats[2] === null)
+assert.throws(() => t3.snapshot(new Int32Array(4)))
+assert.throws(() => t3.snapshot(new Float64Array(poker.SNAPSHOT_SIZE)))
+assert.throws(() => t3.snapshot())
+
+const t4 = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 })
+t4.enableEvents(64)
+t4.sitDown(0, 1000)
+t4.sitDown(1, 1000)
+t4.startHand()
+t4.actionTaken('call')
+const events = new Int32Array(64 * 4)
+assert(poker.decodeEvents(events, t4.drainEvents(events)).length > 0)
+assert.throws(() => t4.enableEvents(-1))
+assert.throws(() => t4.enableEvents('64'))
+assert.throws(() => t4.drainEvents(new Float64Array(64)))
+assert.throws(() => t4.drainEvents())
+
 console.log('success')
 
+
+poker.simulate({
+    forcedBets: { ante: 0, smallBlind: 10, bigBlind: 20 },
+    buyIns: [1000, 1000, 0, 1000],
+    threads: 2,
+    seed: 42
+}, ['checkCall', 'foldToRaise', null, { type: 'mix', fold: 1, call: 2, raise: 1 }], 1000).then(result => {
+    assert(result.handsPlayed === 1000 && result.chipsWon.reduce((a, b) => a + b, 0) === 0)
+    console.log('simulate success')
+})
+const simulateConfig = { forcedBets: { ante: 0, smallBlind: 10, bigBlind: 20 }, buyIns: [1000, 1000] }
+assert.throws(() => poker.simulate(simulateConfig, 'checkCall'))
+assert.throws(() => poker.simulate(simulateConfig, 'checkCall', -1))
+assert.throws(() => poker.simulate({ ...simulateConfig, threads: 0 }, 'checkCall', 10))
+assert.throws(() => poker.simulate({ ...simulateConfig, buyIns: new Array(10).fill(1000) }, 'checkCall', 10))
+assert.throws(() => poker.simulate({ ...simulateConfig, buyIns: [1000, 0] }, 'checkCall', 10))
+assert.throws(() => poker.simulate({ buyIns: [1000, 1000] }, 'checkCall', 10))
+assert.throws(() => poker.simulate({ ...simulateConfig, forcedBets: { smallBlind: 10 } }, 'checkCall', 10))
+
+const set = new poker.TableSet({ size: 4, forcedBets: { ante: 0, smallBlind: 10, bigBlind: 20 }, threads: 2 })
+const commands = []
+for (let i = 0; i < set.size(); ++i) {
+    commands.push(i, poker.Command.SIT_DOWN, 0, 1000)
+    commands.push(i, poker.Command.SIT_DOWN, 1, 1000)
+    commands.push(i, poker.Command.START_HAND, -1, 0)
+    commands.push(i, poker.Command.ACTION_TAKEN, 0, 0)
+}
+const results = set.apply(Int32Array.from(commands))
+for (let i = 0; i < set.size(); ++i) {
+    assert(results[i * 4] === -1, set.errorMessage(i))
+}
+assert.throws(() => new poker.TableSet())
+assert.throws(() => new poker.TableSet({ size: 0, forcedBets: { ante: 0, smallBlind: 10, bigBlind: 20 } }))
+assert.throws(() => new poker.TableSet({ size: 4 }))
+assert.throws(() => set.errorMessage(set.size()))
+assert.throws(() => set.errorMessage(-1))
+assert.throws(() => set.errorMessage('0'))
+assert.throws(() => set.apply(commands))
+assert.throws(() => set.apply(Int32Array.from([0, poker.Command.SHOWDOWN, 0])))
+assert.throws(() => set.apply(Int32Array.from([set.size(), poker.Command.SHOWDOWN, 0, 0])))
+assert.throws(() => set.apply(Int32Array.from([-1, poker.Command.SHOWDOWN, 0, 0])))
+assert.throws(() => set.apply(new Int32Array(0), new Int32Array(set.size() * 4 - 1)))
+assert.throws(() => set.apply(new Int32Array(0), new Float64Array(set.size() * 4)))
+console.log('table set success')
+
+poker.equity([['Ah', 'Ad'], ['Kh', 'Kd']], [], { iterations: 100000, seed: 1 }).then(result => {
+    assert(result.equity[0] > 0.75 && result.equity[0] < 0.87)
+    console.log('equity success')
+})
+const flopHands = [['Ah', 'Ad'], ['Kh', 'Kd'], ['7c', '8c']]
+Promise.all([1, 3].map(threads => poker.equity(flopHands, ['2c', '9c', 'Ks'], { threads }))).then(([one, three]) => {
+    assert(one.exhaustive && three.exhaustive && one.boards === 903 && three.boards === 903)
+    assert.deepStrictEqual(one.win, three.win)
+    console.log('exhaustive equity success')
+})
+assert.throws(() => poker.equity([['Ah', 'Ad'], ['Kh', 'Kd']], [], { iterations: 0 }))
+assert.throws(() => poker.equity([['Ah', 'Ad'], ['Kh', 'Kd']], [], { threads: 0 }))
+assert.throws(() => poker.equity([['Ah', 'Ad'], ['Kh', 'Xd']], []))
+assert.throws(() => poker.equity([['Ah', 'Ad'], ['Kh', 'Kd', 'Qd']], []))
+assert.throws(() => poker.equity([['Ah', 'Ad'], 'KhKd'], []))
+assert.throws(() => poker.equity([['Ah', 'Ad'], ['Kh', 'Kd']], 'Qs'))
+assert.throws(() => poker.equity('AhAd', []))
+
+assert(poker.preflopEquity(['Ah', 'Kh']) > 0.6 && poker.preflopEquity('72o', 'random') < 0.4)
+assert(poker.preflopEquity('AA', 'KK') > 0.8 && poker.preflopEquity('AA', 'KK') < 0.83)
+assert(Math.abs(poker.preflopEquity('AA', 'KK') + poker.preflopEquity('KK', 'AA') - 1) < 1e-4)
+assert(Math.abs(poker.preflopEquity('AA') - 0.8520) < 1e-4 && Math.abs(poker.preflopEquity('AA', 'KK') - 0.8195) < 1e-4)
+assert.throws(() => poker.preflopEquity('XYZ'))
+assert.throws(() => poker.preflopEquity('AKx'))
+assert.throws(() => poker.preflopEquity(['Ah']))
+assert.throws(() => poker.preflopEquity('AA', 'randomly'))
+assert.throws(() => poker.loadPreflopEquityTable(5))
+assert.throws(() => poker.loadPreflopEquityTable('missing_preflop_equity.bin'))
+
+for (const rng of ['mt19937', 'xoshiro256', 'chacha20']) {
+    const tables = [0, 1].map(() => new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20, rng, seed: 42 }))
+    for (const s of tables) {
+        s.sitDown(0, 1000)
+        s.sitDown(1, 1000)
+        s.startHand()
+    }
+    assert(JSON.stringify(tables[0].holeCards()) === JSON.stringify(tables[1].holeCards()))
+}
+console.log('seeded rng success')
+
+const historyPath = require('path').join(require('os').tmpdir(), `poker-history-${process.pid}.bin`)
+const recorded = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20, rng: 'xoshiro256' })
+recorded.sitDown(0, 1000)
+recorded.sitDown(1, 1000)
+recorded.recordHistory(historyPath)
+for (let hand = 0; hand < 10; ++hand) {
+    recorded.startHand()
+    while (recorded.isHandInProgress()) {
+        while (recorded.isBettingRoundInProgress()) {
+            recorded.actionTaken(recorded.legalActions().actions.includes('check') ? 'check' : 'call')
+        }
+        recorded.endBettingRound()
+        if (recorded.areBettingRoundsCompleted()) {
+            recorded.showdown()
+        }
+    }
+}
+recorded.recordHistory()
+const historyBytes = require('fs').readFileSync(historyPath)
+require('fs').unlinkSync(historyPath)
+const replayed = poker.replay(historyBytes)
+assert(replayed.hands === 10)
+assert(JSON.stringify(replayed.table.seats()) === JSON.stringify(recorded.seats()))
+assert(historyBytes.toString('latin1', 0, 4) === 'PKHH' && historyBytes[4] === 1)
+const futureHistory = Buffer.from(historyBytes)
+futureHistory[4] = 2
+assert.throws(() => poker.replay(futureHistory))
+assert.throws(() => poker.replay(historyBytes.subarray(0, historyBytes.length - 1)))
+assert.throws(() => poker.replay())
+assert.throws(() => recorded.recordHistory(5))
+console.log('replay success')
+
+const migrated = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 })
+migrated.sitDown(0, 1000)
+migrated.sitDown(3, 1000)
+migrated.startHand()
+migrated.actionTaken('call')
+const restored = poker.Table.deserialize(migrated.serialize())
+for (const t of [migrated, restored]) {
+    t.actionTaken('check')
+    t.endBettingRound()
+}
+assert(JSON.stringify(restored.snapshot(new Int32Array(poker.SNAPSHOT_SIZE))) === JSON.stringify(migrated.snapshot(new Int32Array(poker.SNAPSHOT_SIZE))))
+assert(poker.Table.deserialize(restored.serialize()).communityCards().length === 3)
+const unjournaled = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20, journal: false })
+unjournaled.sitDown(0, 1000)
+unjournaled.sitDown(3, 1000)
+assert(poker.Table.deserialize(unjournaled.serialize()).seats()[3].stackSize === 1000)
+unjournaled.startHand()
+assert.throws(() => unjournaled.serialize())
+assert.throws(() => unjournaled.fork())
+assert.throws(() => migrated.serialize(new Uint8Array(4)))
+assert.throws(() => migrated.serialize(new Int32Array(1024)))
+assert.throws(() => poker.Table.deserialize(migrated.serialize(), 'xoshiro256'))
+assert.throws(() => poker.Table.deserialize(new Uint8Array(4)))
+assert.throws(() => poker.Table.deserialize())
+console.log('serialize success')
+
+const searched = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 })
+searched.sitDown(0, 1000)
+searched.sitDown(1, 1000)
+searched.startHand()
+const before = searched.snapshot(new Int32Array(poker.SNAPSHOT_SIZE)).slice()
+const actionSet = ['fold', 'check', 'call', 'minRaise', 'allIn']
+const tree = searched.explore(3, actionSet)
+assert(tree.parents.length > 0 && tree.states.length === tree.parents.length * poker.SNAPSHOT_SIZE)
+// Every node holds the state reached by taking the actions on its path from the root.
+for (let node = 0; node < tree.parents.length; ++node) {
+    const path = []
+    for (let n = node; n !== -1; n = tree.parents[n]) {
+        path.unshift(actionSet[tree.actions[n]])
+    }
+    const walked = searched.fork()
+    for (const name of path) {
+        const legal = walked.legalActions()
+        const aggressive = legal.actions.includes('bet') ? 'bet' : 'raise'
+        if (name === 'minRaise') walked.actionTaken(aggressive, legal.chipRange.min)
+        else if (name === 'allIn') walked.actionTaken(aggressive, legal.chipRange.max)
+        else walked.actionTaken(name)
+    }
+    const state = tree.states.subarray(node * poker.SNAPSHOT_SIZE, (node + 1) * poker.SNAPSHOT_SIZE)
+    assert.deepStrictEqual(walked.snapshot(new Int32Array(poker.SNAPSHOT_SIZE)), Int32Array.from(state))
+}
+assert.throws(() => searched.explore(3))
+assert.throws(() => searched.explore('3', actionSet))
+assert.throws(() => searched.explore(3, ['bogus']))
+assert.throws(() => searched.explore(3, actionSet, -1))
+assert.throws(() => searched.explore(3, actionSet, 1))
+assert.throws(() => poker.replay('history'))
+assert(JSON.stringify(searched.snapshot(new Int32Array(poker.SNAPSHOT_SIZE))) === JSON.stringify(before))
+const forked = searched.fork()
+forked.actionTaken('fold')
+assert(searched.isBettingRoundInProgress() && !forked.isBettingRoundInProgress())
+console.log('explore success')
+
+const fast = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 })
+fast.sitDown(0, 1000)
+fast.sitDown(1, 1000)
+fast.startHand()
+fast.actionTaken(poker.Action.RAISE, 60)
+fast.actionTaken(poker.Action.CALL)
+assert(fast.roundOfBetting() === 'preflop' && !fast.isBettingRoundInProgress())
+fast.endBettingRound()
+assert(fast.roundOfBetting() === 'flop')
+assert.throws(() => fast.actionTaken('bogus'))
+assert.throws(() => fast.actionTaken('check'.repeat(4)))
+assert.throws(() => fast.setAutomaticAction(1, 'bogus'))
+assert(fast.isBettingRoundInProgress() && fast.roundOfBetting() === 'flop')
+console.log('integer actions success')
+
+const metrics = poker.decodeMetrics(poker.metrics())
+assert(poker.metrics().length === poker.METRICS_SIZE)
+assert.throws(() => poker.metrics(new Float64Array(poker.METRICS_SIZE - 1)))
+assert.throws(() => poker.metrics(new Int32Array(poker.METRICS_SIZE)))
+assert(!metrics.enabled || metrics.methods.startHand.calls > 0)
+console.log('metrics success')
+
+const bots = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 })
+bots.sitDown(0, 1000)
+bots.sitDown(1, 1000)
+bots.sitDown(2, 1000)
+bots.setPolicy(0, 'checkCall')
+bots.setPolicy(1, { type: 'range', raise: 'AA,KK,QQ,AKs', call: ['JJ', 'TT', 'AQs'] })
+bots.setPolicy(2, { type: 'equity', call: 0.3, raise: 0.6, iterations: 100 })
+assert.throws(() => bots.setPolicy(9, 'checkCall'))
+assert.throws(() => bots.setPolicy(-1, 'checkCall'))
+assert.throws(() => bots.setPolicy('0', 'checkCall'))
+assert.throws(() => bots.setPolicy(3, 'bogus'))
+assert.throws(() => bots.setPolicy(3, 42))
+assert.throws(() => bots.setPolicy(3, { type: 'bogus' }))
+assert.throws(() => bots.setPolicy(3, { type: 'mix', fold: 0, call: 0, raise: 0 }))
+assert.throws(() => bots.setPolicy(3, { type: 'mix', fold: -1, call: 1 }))
+assert.throws(() => bots.setPolicy(3, { type: 'mix', call: '1' }))
+assert.throws(() => bots.setPolicy(3, { type: 'equity', iterations: 0 }))
+assert.throws(() => bots.setPolicy(3, { type: 'range', raise: 'AA,XY' }))
+assert.throws(() => bots.setPolicy(3, { type: 'range', raise: ['AA', 7] }))
+assert.throws(() => bots.setPolicy(3, { type: 'range', raise: 7 }))
+bots.startHand()
+assert(bots.advance() > 0 && !bots.isHandInProgress())
+bots.setPolicy(2, null)
+bots.startHand()
+bots.advance()
+assert(!bots.isHandInProgress() || bots.playerToAct() === 2)
+console.log('advance success')
+
+const { Worker } = require('worker_threads')
+const moved = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 })
+moved.sitDown(0, 1000)
+moved.sitDown(1, 1000)
+moved.startHand()
+const shared = new Uint8Array(new SharedArrayBuffer(4096))
+const movedLength = moved.serialize(shared)
+const worker = new Worker(`
+    const { parentPort, workerData } = require('worker_threads')
+    const poker = require(${JSON.stringify(require.resolve('./poker'))})
+    const table = poker.Table.deserialize(workerData.buffer.subarray(0, workerData.length))
+    table.actionTaken('call')
+    table.actionTaken('check')
+    table.endBettingRound()
+    parentPort.postMessage(table.serialize(workerData.buffer))
+`, { eval: true, workerData: { buffer: shared, length: movedLength } })
+worker.on('message', length => {
+    const back = poker.Table.deserialize(shared.subarray(0, length))
+    assert(back.roundOfBetting() === 'flop' && back.communityCards().length === 3)
+    console.log('worker threads success')
+})
+
+const tournament = new poker.Tournament({
+    entrants: 100,
+    stack: 1500,
+    levels: [
+        { ante: 0, smallBlind: 10, bigBlind: 20, hands: 10 },
+        { ante: 5, smallBlind: 25, bigBlind: 50, hands: 10 },
+        { ante: 25, smallBlind: 100, bigBlind: 200 }
+    ],
+    payouts: [500, 300, 200],
+    policy: [{ type: 'mix', fold: 1, call: 2, raise: 1 }, 'checkCall'],
+    seed: 7
+})
+assert(tournament.numTables() === 12)
+while (!tournament.isFinished()) {
+    tournament.play(100)
+}
+const places = tournament.places()
+assert(tournament.eliminations().length === 99 && places.filter(p => p === 1).length === 1)
+assert(tournament.payouts().reduce((a, b) => a + b, 0) === 1000)
+assert(tournament.stacks().reduce((a, b) => a + b, 0) === 100 * 1500)
+const tournamentOptions = { entrants: 10, stack: 1500, levels: [{ smallBlind: 10, bigBlind: 20 }] }
+assert.throws(() => new poker.Tournament())
+assert.throws(() => new poker.Tournament({ entrants: 10, stack: 1500 }))
+assert.throws(() => new poker.Tournament({ ...tournamentOptions, levels: [5] }))
+assert.throws(() => new poker.Tournament({ ...tournamentOptions, levels: [{ smallBlind: '10', bigBlind: 20 }] }))
+assert.throws(() => new poker.Tournament({ ...tournamentOptions, payouts: ['500'] }))
+assert.throws(() => tournament.play(-1))
+assert.throws(() => tournament.play('1'))
+assert.throws(() => tournament.tick())
+console.log('tournament success')
+
+const ahkh = poker.cardSet(['Ah', 'Kh'])
+const flop = poker.cardSet(['2h', '7h', 'Tc'])
+assert(poker.cardsOf(ahkh).length === 2 && (ahkh & flop) === 0n)
+assert(poker.handCategory(ahkh | flop) === poker.HandCategory.HIGH_CARD)
+assert(poker.handCategory(['As', 'Ad', 'Ac', '9h', '9d']) === poker.HandCategory.FULL_HOUSE)
+const texture = poker.boardTexture(flop)
+assert(!texture.paired && texture.maxSuited === 2 && texture.flushDraw && !texture.flushPossible)
+assert(texture.straightDraw && !texture.backdoorFlushDraw)
+const rainbow = poker.boardTexture(['2c', '7d', 'Kh'])
+assert(!rainbow.flushDraw && rainbow.backdoorFlushDraw && !rainbow.straightDraw && rainbow.backdoorStraightDraw)
+assert(poker.cardsOf(poker.outs(ahkh, flop)).length === 15)
+const eightCards = poker.cardSet(['As', 'Ad', 'Ac', 'Ah', '9h', '9d', '9c', '9s'])
+assert.throws(() => poker.handCategory(eightCards))
+assert.throws(() => poker.boardTexture(poker.cardSet(['2h', '7h', 'Tc', 'Jd', 'Qs', 'Ks'])))
+assert.throws(() => poker.outs(ahkh, flop | poker.cardSet(['Jd', 'Qs'])))
+assert.throws(() => poker.outs(ahkh, ahkh))
+assert.throws(() => poker.outs(flop, 0n))
+assert.throws(() => poker.cardSet(1n << 13n))
+assert.throws(() => poker.cardSet())
+assert.throws(() => poker.cardsOf())
+const dealt = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 })
+dealt.sitDown(0, 1000)
+dealt.sitDown(1, 1000)
+dealt.startHand()
+assert(poker.cardsOf(dealt.holeCardSets()[0]).length === 2 && dealt.communityCardSet() === 0n)
+console.log('card sets success')
+
+let rangeProgress = 0
+poker.rangeEquity('22+, A2s+, KTo+', '15%', ['Ah', '7d', '2c'], { seed: 1, onProgress: () => ++rangeProgress }).then(result => {
+    assert(Math.abs(result.equity[0] + result.equity[1] - 1) < 1e-9)
+    assert(result.exhaustive && result.boards === result.totalBoards)
+    assert(Math.abs(result.categories[0].reduce((a, b) => a + b, 0) - 1) < 1e-9)
+    // Progress is delivered through its own queue, which is drained by the end of this turn of the event loop.
+    setImmediate(() => assert(rangeProgress > 0))
+    return poker.rangeEquity('AA', 'KK', [], { seed: 1 })
+}).then(result => {
+    assert(!result.exhaustive && Math.abs(result.equity[0] - 0.82) < 0.01)
+    console.log('range equity success')
+})
+assert.throws(() => poker.rangeEquity('AA'))
+assert.throws(() => poker.rangeEquity(5, 'KK'))
+assert.throws(() => poker.rangeEquity('AA', 'KK', [], { boards: 0 }))
+assert.throws(() => poker.rangeEquity('AA', 'KK', [], { threads: 0 }))
+
+const batched = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 })
+const C = poker.Command
+const batchState = new Int32Array(poker.SNAPSHOT_SIZE)
+const batchCommands = Int32Array.from([
+    C.SIT_DOWN, 0, 1000,
+    C.SIT_DOWN, 1, 1000,
+    C.START_HAND, -1, 0,
+    C.ACTION_TAKEN, poker.Action.CALL, 0,
+    C.ACTION_TAKEN, poker.Action.CHECK, 0,
+    C.ACTION_TAKEN, poker.Action.RAISE, 5,
+    C.ACTION_TAKEN, poker.Action.CHECK, 0
+])
+assert(batched.applyBatch(batchCommands, batchState) === 5 && batched.batchError() !== '')
+assert(batched.roundOfBetting() === 'flop' && batched.communityCards().length === 3)
+assert(poker.decodeSnapshot(batchState).communityCards.length === 3)
+assert(batched.applyBatch(Int32Array.from([C.ACTION_TAKEN, poker.Action.CHECK, 0])) === -1 && batched.batchError() === '')
+assert.throws(() => batched.applyBatch([C.SHOWDOWN, 0, 0]))
+assert.throws(() => batched.applyBatch(Int32Array.from([C.SHOWDOWN, 0])))
+assert.throws(() => batched.applyBatch(new Int32Array(0), new Int32Array(poker.SNAPSHOT_SIZE - 1)))
+assert(batched.applyBatch(Int32Array.from([C.START_HAND, -2, 0])) === 0 && batched.batchError() !== '')
+assert.throws(() => new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 }).startHand(-1))
+assert.throws(() => new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 }).startHand('0'))
+console.log('apply batch success')
+
+const strict = new poker.Table({ ante: 0, smallBlind: 10, bigBlind: 20 })
+strict.sitDown(0, 1000)
+strict.sitDown(1, 1000)
+const legal = new Int32Array(3)
+assert(strict.legalMask(legal)[0] === 0 && strict.tryAction(poker.Action.CALL) === poker.ActionStatus.NO_BETTING_ROUND)
+strict.startHand()
+strict.legalMask(legal)
+assert(legal[0] & (1 << poker.Action.CALL) && !(legal[0] & (1 << poker.Action.CHECK)) && legal[2] >= legal[1])
+assert(strict.tryAction(poker.Action.CHECK) === poker.ActionStatus.ILLEGAL_ACTION)
+assert(strict.tryAction(9) === poker.ActionStatus.INVALID_ACTION_CODE)
+assert(strict.tryAction(poker.Action.RAISE, legal[2] + 1) === poker.ActionStatus.INVALID_BET_SIZE)
+assert(strict.tryAction(poker.Action.RAISE, legal[1]) === poker.ActionStatus.OK)
+assert.throws(() => strict.legalMask(new Int32Array(2)))
+assert.throws(() => strict.legalMask(5))
+assert.throws(() => strict.tryAction('call'))
+assert.throws(() => strict.tryAction(poker.Action.RAISE, '100'))
+console.log('try action success')
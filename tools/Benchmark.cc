@@ -0,0 +1,126 @@
+// Measures the core table engine without N-API, as a baseline for the JS benchmarks in bench.js.
+//
+// Usage: benchmark [seconds per benchmark]
+//
+// Prints a JSON object with one entry per benchmark to stdout.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <random>
+#include <string>
+#include <vector>
+
+#define POKER_THROW_ON_ERROR
+#include "poker/table.hpp"
+
+#include "Rng.h"
+#include "Snapshot.h"
+
+namespace {
+
+struct Result {
+    const char* name;
+    std::uint64_t iterations;
+    double seconds;
+};
+
+// Calls run(batch) with growing batches until at least seconds have passed.
+template<class F>
+Result Measure(const char* name, double seconds, F&& run) {
+    using clock = std::chrono::steady_clock;
+    auto iterations = std::uint64_t{0};
+    auto batch = std::uint64_t{1};
+    const auto start = clock::now();
+    auto elapsed = 0.0;
+    while (elapsed < seconds) {
+        run(batch);
+        iterations += batch;
+        batch *= 2;
+        elapsed = std::chrono::duration<double>(clock::now() - start).count();
+    }
+    return {name, iterations, elapsed};
+}
+
+const auto forced_bets = poker::forced_bets{poker::blinds{10, 20}, 0};
+
+void SeatPlayers(poker::table& table, int num_players) {
+    for (auto i = 0; i < num_players; ++i) {
+        table.sit_down(i, 1000000);
+    }
+}
+
+// Plays a hand in which everyone checks or calls.
+template<class URBG>
+void PlayHand(poker::table& table, URBG& rng) {
+    table.start_hand(rng);
+    while (table.hand_in_progress()) {
+        while (table.betting_round_in_progress()) {
+            const auto legal = table.legal_actions();
+            table.action_taken(static_cast<bool>(legal.action & poker::action::check)
+                ? poker::action::check : poker::action::call);
+        }
+        table.end_betting_round();
+        if (table.betting_rounds_completed()) {
+            table.showdown();
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) try {
+    const auto seconds = argc > 1 ? std::stod(argv[1]) : 1.0;
+    auto results = std::vector<Result>{};
+
+    for (const auto num_players : { 2, 9 }) {
+        auto table = poker::table{forced_bets};
+        SeatPlayers(table, num_players);
+        auto rng = Xoshiro256{1};
+        const auto name = num_players == 2 ? "native.hands.headsUp" : "native.hands.fullRing";
+        results.push_back(Measure(name, seconds, [&](std::uint64_t batch) {
+            for (std::uint64_t i = 0; i < batch; ++i) {
+                PlayHand(table, rng);
+            }
+        }));
+    }
+
+    {
+        auto table = poker::table{forced_bets};
+        SeatPlayers(table, 9);
+        auto rng = std::mt19937{1};
+        results.push_back(Measure("native.hands.fullRing.mt19937", seconds, [&](std::uint64_t batch) {
+            for (std::uint64_t i = 0; i < batch; ++i) {
+                PlayHand(table, rng);
+            }
+        }));
+    }
+
+    {
+        auto table = poker::table{forced_bets};
+        SeatPlayers(table, 9);
+        auto rng = Xoshiro256{1};
+        table.start_hand(rng);
+        std::int32_t buffer[snapshot::size];
+        results.push_back(Measure("native.snapshot", seconds, [&](std::uint64_t batch) {
+            for (std::uint64_t i = 0; i < batch; ++i) {
+                WriteSnapshot(table, buffer);
+            }
+        }));
+    }
+
+    std::printf("{\n  \"results\": [\n");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        std::printf("    { \"name\": \"%s\", \"iterations\": %llu, \"seconds\": %.6f, \"opsPerSec\": %.1f, \"nsPerOp\": %.2f }%s\n",
+                    r.name, static_cast<unsigned long long>(r.iterations), r.seconds,
+                    r.iterations / r.seconds, r.seconds * 1e9 / r.iterations,
+                    i + 1 < results.size() ? "," : "");
+    }
+    std::printf("  ]\n}\n");
+    return 0;
+} catch (const std::exception& e) {
+    std::fprintf(stderr, "%s\n", e.what());
+    return 1;
+}
@@ -0,0 +1,245 @@
+// Generates the heads-up preflop equity table loaded by poker.preflopEquity.
+//
+// Usage: generate_preflop_equity <output file> [threads]
+//
+// The table is exact: every pair of non-conflicting concrete hands is compared on every board. Boards are
+// enumerated once rather than per matchup, and boards which only differ by a permutation of suits are
+// enumerated once with a weight, since they give every pair of classes the same results. On each board the
+// hands are sorted by strength, and each hand is compared against all weaker or equal hands of every class at
+// once by counting the hands of each class already processed, minus those sharing one of its cards.
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "HandEvaluator.h"
+#include "PreflopEquity.h"
+
+namespace {
+
+constexpr std::int32_t num_classes = num_hand_classes;
+
+// The number of boards which conflict with neither card of two non-conflicting hands: C(48, 5).
+constexpr double boards_per_pair = 1712304.0;
+
+struct Board {
+    std::array<std::int32_t, 5> cards;
+    std::uint32_t weight;
+};
+
+// Returns the boards up to a permutation of suits, each with the number of boards it stands for.
+std::vector<Board> CanonicalBoards() {
+    auto permutations = std::vector<std::array<std::int32_t, 4>>{};
+    auto suits = std::array<std::int32_t, 4>{0, 1, 2, 3};
+    do {
+        permutations.push_back(suits);
+    } while (std::next_permutation(suits.begin(), suits.end()));
+
+    auto keys = std::vector<std::uint32_t>{};
+    keys.reserve(2598960);
+    std::array<std::int32_t, 5> b;
+    for (b[0] = 0; b[0] < num_cards; ++b[0])
+    for (b[1] = b[0] + 1; b[1] < num_cards; ++b[1])
+    for (b[2] = b[1] + 1; b[2] < num_cards; ++b[2])
+    for (b[3] = b[2] + 1; b[3] < num_cards; ++b[3])
+    for (b[4] = b[3] + 1; b[4] < num_cards; ++b[4]) {
+        auto key = ~std::uint32_t{0};
+        for (const auto& permutation : permutations) {
+            auto cards = std::array<std::int32_t, 5>{};
+            for (std::size_t i = 0; i < cards.size(); ++i) {
+                cards[i] = CardRank(b[i]) * 4 + permutation[CardSuit(b[i])];
+            }
+            std::sort(cards.begin(), cards.end());
+            auto permuted = std::uint32_t{0};
+            for (const auto card : cards) {
+                permuted = permuted << 6 | static_cast<std::uint32_t>(card);
+            }
+            key = std::min(key, permuted);
+        }
+        keys.push_back(key);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    auto boards = std::vector<Board>{};
+    for (std::size_t i = 0; i < keys.size();) {
+        auto j = i;
+        while (j < keys.size() && keys[j] == keys[i]) {
+            ++j;
+        }
+        auto board = Board{{}, static_cast<std::uint32_t>(j - i)};
+        for (std::size_t k = 0; k < board.cards.size(); ++k) {
+            board.cards[k] = static_cast<std::int32_t>(keys[i] >> (6 * (4 - k)) & 63);
+        }
+        boards.push_back(board);
+        i = j;
+    }
+    return boards;
+}
+
+// Accumulates, for each pair of classes, twice the wins plus the ties of the first class against the second
+// over a range of boards.
+class Scorer {
+public:
+    Scorer() : _scores(num_classes * num_classes), _board_scores(num_classes * num_classes) {
+        for (std::int32_t x = 0; x < num_cards; ++x) {
+            for (std::int32_t y = 0; y < num_cards; ++y) {
+                _classes[x][y] = x == y ? -1 : HandClass(x, y);
+            }
+        }
+    }
+
+    void Score(const Board& board) {
+        auto board_set = CardSet{0};
+        for (const auto card : board.cards) {
+            board_set |= CardBit(card);
+        }
+        _hands.clear();
+        for (std::int32_t x = 0; x < num_cards; ++x) {
+            if (board_set & CardBit(x)) {
+                continue;
+            }
+            for (std::int32_t y = x + 1; y < num_cards; ++y) {
+                if (!(board_set & CardBit(y))) {
+                    const auto strength = EvaluateHand(board_set | CardBit(x) | CardBit(y));
+                    _hands.push_back(static_cast<std::uint64_t>(strength) << 12 | x << 6 | y);
+                }
+            }
+        }
+        std::sort(_hands.begin(), _hands.end());
+
+        std::fill(_board_scores.begin(), _board_scores.end(), 0);
+        std::memset(_processed, 0, sizeof(_processed));
+        std::memset(_processed_with, 0, sizeof(_processed_with));
+        for (std::size_t begin = 0; begin < _hands.size();) {
+            auto end = begin;
+            while (end < _hands.size() && _hands[end] >> 12 == _hands[begin] >> 12) {
+                ++end;
+            }
+            // Counted once against the weaker hands and once against the weaker or equal ones, a hand scores
+            // two for a win and one for a tie.
+            AddProcessed(begin, end, false);
+            for (auto i = begin; i < end; ++i) {
+                const auto x = static_cast<std::int32_t>(_hands[i] >> 6 & 63);
+                const auto y = static_cast<std::int32_t>(_hands[i] & 63);
+                const auto hand_class = _classes[x][y];
+                ++_processed[hand_class];
+                ++_processed_with[x][hand_class];
+                ++_processed_with[y][hand_class];
+            }
+            AddProcessed(begin, end, true);
+            begin = end;
+        }
+
+        for (std::size_t i = 0; i < _scores.size(); ++i) {
+            _scores[i] += static_cast<std::uint64_t>(board.weight) * static_cast<std::uint32_t>(_board_scores[i]);
+        }
+    }
+
+    const std::vector<std::uint64_t>& Scores() const noexcept {
+        return _scores;
+    }
+
+private:
+    // Adds the processed hands of each class which do not conflict with each hand of the group. A processed
+    // hand is subtracted once per card it shares, so once the group is processed, each hand of it, which
+    // shares both cards with itself, is subtracted once too many.
+    void AddProcessed(std::size_t begin, std::size_t end, bool group_processed) {
+        for (auto i = begin; i < end; ++i) {
+            const auto x = static_cast<std::int32_t>(_hands[i] >> 6 & 63);
+            const auto y = static_cast<std::int32_t>(_hands[i] & 63);
+            const auto hand_class = _classes[x][y];
+            auto* row = &_board_scores[hand_class * num_classes];
+            for (std::int32_t c = 0; c < num_classes; ++c) {
+                row[c] += _processed[c] - _processed_with[x][c] - _processed_with[y][c];
+            }
+            row[hand_class] += group_processed;
+        }
+    }
+
+    std::vector<std::uint64_t> _scores;
+    std::vector<std::int32_t> _board_scores;
+    std::vector<std::uint64_t> _hands;
+    std::int32_t _classes[num_cards][num_cards];
+    std::int32_t _processed[num_classes];
+    std::int32_t _processed_with[num_cards][num_classes];
+};
+
+} // namespace
+
+int main(int argc, char** argv) try {
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: %s <output file> [threads]\n", argv[0]);
+        return 1;
+    }
+    const auto path = std::string{argv[1]};
+    const auto num_threads = argc > 2 ? static_cast<std::size_t>(std::stoul(argv[2]))
+                                      : std::size_t{std::max(1u, std::thread::hardware_concurrency())};
+
+    if (num_threads == 0) {
+        std::fprintf(stderr, "threads must be positive\n");
+        return 1;
+    }
+
+    const auto boards = CanonicalBoards();
+    std::fprintf(stderr, "%zu boards up to suit permutations\n", boards.size());
+    auto scorers = std::vector<Scorer>(num_threads);
+    auto threads = std::vector<std::thread>{};
+    for (std::size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            const auto begin = boards.size() * t / num_threads;
+            const auto end = boards.size() * (t + 1) / num_threads;
+            for (auto i = begin; i < end; ++i) {
+                scorers[t].Score(boards[i]);
+                if (t == 0 && (i - begin + 1) % 10000 == 0) {
+                    std::fprintf(stderr, "%zu/%zu\n", (i - begin + 1) * num_threads, boards.size());
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every pair of non-conflicting hands meets on the same number of boards, so dividing by the number of
+    // such pairs between two classes averages over the concrete combinations of both.
+    auto pairs = std::vector<std::uint64_t>(num_classes * num_classes);
+    for (std::int32_t a = 0; a < num_cards; ++a) {
+        for (std::int32_t b = a + 1; b < num_cards; ++b) {
+            for (std::int32_t c = 0; c < num_cards; ++c) {
+                for (std::int32_t d = c + 1; d < num_cards; ++d) {
+                    if (c != a && c != b && d != a && d != b) {
+                        ++pairs[HandClass(a, b) * num_classes + HandClass(c, d)];
+                    }
+                }
+            }
+        }
+    }
+
+    constexpr auto columns = PreflopEquityTable::num_columns;
+    auto equities = std::vector<double>(num_classes * columns);
+    for (std::int32_t a = 0; a < num_classes; ++a) {
+        auto score = 0.0;
+        auto total = 0.0;
+        for (std::int32_t b = 0; b < num_classes; ++b) {
+            auto matchup_score = 0.0;
+            for (const auto& scorer : scorers) {
+                matchup_score += static_cast<double>(scorer.Scores()[a * num_classes + b]);
+            }
+            const auto matchup_total = 2.0 * boards_per_pair * static_cast<double>(pairs[a * num_classes + b]);
+            equities[a * columns + b] = matchup_score / matchup_total;
+            score += matchup_score;
+            total += matchup_total;
+        }
+        equities[a * columns + num_classes] = score / total;
+    }
+
+    PreflopEquityTable::Write(path, equities);
+    return 0;
+} catch (const std::exception& e) {
+    std::fprintf(stderr, "%s\n", e.what());
+    return 1;
+}
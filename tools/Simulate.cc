@@ -0,0 +1,347 @@
+// Plays hands between native policies without Node, for offline strategy evaluation.
+//
+// Usage: simulate <config> [output]
+//
+// The config is a text file with one setting per line; '#' starts a comment:
+//   forced_bets <ante> <small blind> <big blind>
+//   seat <index> <buy-in> <policy>   one line per occupied seat, at least 2
+//   hands <count>
+//   batch <count>                    hands per output row and thread (default 100000)
+//   threads <count>                  default: every core
+//   seed <number>                    default: random
+//   format csv|binary                default: csv
+// where <policy> is one of
+//   check_call
+//   fold_to_raise
+//   mix <fold weight> <call weight> <raise weight>
+//   equity <call equity> <raise equity> [iterations]
+//   range <raise range> [| <call range>]      in the range notation of poker.rangeEquity
+//
+// Every thread plays its share of the hands on its own table, seeded with stream <thread> of the seed, and
+// writes a row of results after every batch, so memory use does not grow with the number of hands. Results are
+// determined by the seed and the number of threads, though rows of different threads may come in any order.
+// Output goes to stdout when no output file is given; the binary format needs a file. A summary is printed to
+// stderr.
+//
+// CSV rows are thread,batch,hands,showdowns,chips_0,...,chips_8 where chips_i is the net amount won by seat i.
+// The binary format is the magic "PKSR" and a version byte, followed by one record per row: u32 thread, u32
+// batch, u64 hands, u64 showdowns and i64 chips of each of the 9 seats, little-endian.
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "PreflopEquity.h"
+#include "Range.h"
+#include "Rng.h"
+#include "Simulator.h"
+
+namespace {
+
+constexpr char magic[4] = { 'P', 'K', 'S', 'R' };
+constexpr std::uint8_t version = 1;
+
+enum class Format { csv, binary };
+
+struct Options {
+    SimulationConfig config;
+    std::uint64_t num_hands = 0;
+    std::uint64_t batch_size = 100000;
+    unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::uint64_t seed = 0;
+    bool has_seed = false;
+    Format format = Format::csv;
+};
+
+std::string Trim(const std::string& s) {
+    const auto begin = s.find_first_not_of(" \t\r");
+    const auto end = s.find_last_not_of(" \t\r");
+    return begin == std::string::npos ? std::string{} : s.substr(begin, end - begin + 1);
+}
+
+std::bitset<num_hand_classes> ToHandClasses(const std::string& range) {
+    auto classes = std::bitset<num_hand_classes>{};
+    if (!range.empty()) {
+        for (const auto& combo : ParseRange(range)) {
+            classes.set(static_cast<std::size_t>(HandClass(combo[0], combo[1])));
+        }
+    }
+    return classes;
+}
+
+Policy ParsePolicy(std::istringstream& line) {
+    auto policy = Policy{};
+    auto name = std::string{};
+    line >> name;
+    if (name == "check_call") {
+        policy.kind = Policy::Kind::check_call;
+    } else if (name == "fold_to_raise") {
+        policy.kind = Policy::Kind::fold_to_raise;
+    } else if (name == "mix") {
+        policy.kind = Policy::Kind::mix;
+        if (!(line >> policy.fold_weight >> policy.passive_weight >> policy.aggressive_weight)
+            || policy.fold_weight < 0 || policy.passive_weight < 0 || policy.aggressive_weight < 0
+            || policy.fold_weight + policy.passive_weight + policy.aggressive_weight <= 0) {
+            throw std::invalid_argument{"Invalid policy: weights must be non-negative and not all zero"};
+        }
+    } else if (name == "equity") {
+        policy.kind = Policy::Kind::equity_threshold;
+        if (!(line >> policy.call_equity >> policy.raise_equity)) {
+            throw std::invalid_argument{"Invalid policy: expected call and raise equity"};
+        }
+        auto iterations = static_cast<double>(policy.equity_iterations);
+        if (line >> iterations && iterations < 1) {
+            throw std::invalid_argument{"Invalid policy: iterations must be positive"};
+        }
+        policy.equity_iterations = static_cast<std::uint32_t>(iterations);
+    } else if (name == "range") {
+        policy.kind = Policy::Kind::range;
+        auto ranges = std::string{};
+        std::getline(line, ranges);
+        const auto bar = ranges.find('|');
+        policy.raise_range = ToHandClasses(Trim(ranges.substr(0, bar)));
+        if (bar != std::string::npos) {
+            policy.call_range = ToHandClasses(Trim(ranges.substr(bar + 1)));
+        }
+    } else {
+        throw std::invalid_argument{"Invalid policy: " + name};
+    }
+    return policy;
+}
+
+Options ReadOptions(const std::string& path) {
+    auto file = std::ifstream{path};
+    if (!file) {
+        throw std::runtime_error{"Cannot open " + path};
+    }
+    auto options = Options{};
+    auto has_forced_bets = false;
+    auto num_players = 0;
+    auto line_number = 0;
+    for (std::string text; std::getline(file, text);) {
+        ++line_number;
+        text = Trim(text.substr(0, text.find('#')));
+        if (text.empty()) {
+            continue;
+        }
+        try {
+            auto line = std::istringstream{text};
+            auto key = std::string{};
+            line >> key;
+            auto& config = options.config;
+            if (key == "forced_bets") {
+                if (!(line >> config.ante >> config.small_blind >> config.big_blind)) {
+                    throw std::invalid_argument{"Expected ante, small blind and big blind"};
+                }
+                has_forced_bets = true;
+            } else if (key == "seat") {
+                auto seat = std::size_t{0};
+                auto buy_in = 0;
+                if (!(line >> seat >> buy_in) || seat >= poker::table::num_seats || buy_in <= 0) {
+                    throw std::invalid_argument{"Expected a seat index from 0 to 8 and a positive buy-in"};
+                }
+                if (config.buy_ins[seat] == 0) {
+                    ++num_players;
+                }
+                config.buy_ins[seat] = buy_in;
+                config.policies[seat] = ParsePolicy(line);
+            } else if (key == "hands") {
+                if (!(line >> options.num_hands)) {
+                    throw std::invalid_argument{"Expected the number of hands"};
+                }
+            } else if (key == "batch") {
+                if (!(line >> options.batch_size) || options.batch_size == 0) {
+                    throw std::invalid_argument{"The batch size must be positive"};
+                }
+            } else if (key == "threads") {
+                if (!(line >> options.num_threads) || options.num_threads == 0) {
+                    throw std::invalid_argument{"The number of threads must be positive"};
+                }
+            } else if (key == "seed") {
+                if (!(line >> options.seed)) {
+                    throw std::invalid_argument{"Expected the seed"};
+                }
+                options.has_seed = true;
+            } else if (key == "format") {
+                auto format = std::string{};
+                line >> format;
+                if (format == "csv") options.format = Format::csv;
+                else if (format == "binary") options.format = Format::binary;
+                else throw std::invalid_argument{"Expected format csv or binary"};
+            } else {
+                throw std::invalid_argument{"Unknown setting " + key};
+            }
+        } catch (const std::invalid_argument& e) {
+            throw std::runtime_error{path + ":" + std::to_string(line_number) + ": " + e.what()};
+        }
+    }
+    if (!has_forced_bets) {
+        throw std::runtime_error{path + ": missing forced_bets"};
+    }
+    if (num_players < 2) {
+        throw std::runtime_error{path + ": at least 2 seats are needed"};
+    }
+    if (!options.has_seed) {
+        options.seed = RandomSeed();
+    }
+    return options;
+}
+
+// Writes the rows of every thread to one file. Rows are formatted by the thread which produced them and
+// only the write itself is serialized.
+class ResultWriter {
+public:
+    ResultWriter(std::FILE* file, Format format) : _file(file), _format(format) {
+        if (_format == Format::csv) {
+            auto header = std::string{"thread,batch,hands,showdowns"};
+            for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+                header += ",chips_" + std::to_string(i);
+            }
+            header += '\n';
+            Write(header.data(), header.size());
+        } else {
+            Write(magic, sizeof(magic));
+            Write(&version, sizeof(version));
+        }
+    }
+
+    void Row(std::uint32_t thread, std::uint32_t batch, const SimulationResult& result) {
+        auto row = std::string{};
+        if (_format == Format::csv) {
+            row = std::to_string(thread) + ',' + std::to_string(batch) + ',' + std::to_string(result.hands_played)
+                + ',' + std::to_string(result.showdowns);
+            for (const auto chips : result.chips_won) {
+                row += ',' + std::to_string(chips);
+            }
+            row += '\n';
+        } else {
+            PutU64(row, thread, 4);
+            PutU64(row, batch, 4);
+            PutU64(row, result.hands_played, 8);
+            PutU64(row, result.showdowns, 8);
+            for (const auto chips : result.chips_won) {
+                PutU64(row, static_cast<std::uint64_t>(chips), 8);
+            }
+        }
+        auto lock = std::lock_guard<std::mutex>{_mutex};
+        Write(row.data(), row.size());
+    }
+
+    void Flush() {
+        if (std::fflush(_file) != 0) {
+            throw std::runtime_error{"Failed to write the results"};
+        }
+    }
+
+private:
+    static void PutU64(std::string& out, std::uint64_t value, std::size_t bytes) {
+        for (std::size_t i = 0; i < bytes; ++i) {
+            out += static_cast<char>((value >> (8 * i)) & 0xff);
+        }
+    }
+
+    void Write(const void* data, std::size_t size) {
+        if (std::fwrite(data, 1, size, _file) != size) {
+            throw std::runtime_error{"Failed to write the results"};
+        }
+    }
+
+    std::FILE* _file;
+    Format _format;
+    std::mutex _mutex;
+};
+
+SimulationResult Run(const Options& options, ResultWriter& writer) {
+    const auto num_threads = options.num_threads;
+    auto totals = std::vector<SimulationResult>(num_threads);
+    auto errors = std::vector<std::exception_ptr>(num_threads);
+    auto failed = std::atomic<bool>{false};
+    auto threads = std::vector<std::thread>{};
+    threads.reserve(num_threads);
+    for (unsigned i = 0; i < num_threads; ++i) {
+        const auto share = options.num_hands / num_threads + (i < options.num_hands % num_threads ? 1 : 0);
+        threads.emplace_back([&, i, share] {
+            try {
+                auto simulator = HandSimulator{options.config, options.seed, i};
+                auto batch = std::uint32_t{0};
+                for (auto remaining = share; remaining > 0 && !failed; ++batch) {
+                    const auto size = std::min(remaining, options.batch_size);
+                    const auto result = simulator.Play(size);
+                    writer.Row(i, batch, result);
+                    totals[i] += result;
+                    remaining -= size;
+                }
+            } catch (...) {
+                errors[i] = std::current_exception();
+                failed = true;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto total = SimulationResult{};
+    for (unsigned i = 0; i < num_threads; ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        total += totals[i];
+    }
+    return total;
+}
+
+} // namespace
+
+int main(int argc, char** argv) try {
+    if (argc < 2 || argc > 3) {
+        std::fprintf(stderr, "Usage: simulate <config> [output]\n");
+        return 2;
+    }
+    const auto options = ReadOptions(argv[1]);
+
+    auto file = stdout;
+    if (argc == 3) {
+        file = std::fopen(argv[2], options.format == Format::binary ? "wb" : "w");
+        if (file == nullptr) {
+            throw std::runtime_error{std::string{"Cannot open "} + argv[2]};
+        }
+    } else if (options.format == Format::binary) {
+        throw std::runtime_error{"The binary format needs an output file"};
+    }
+
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    auto writer = ResultWriter{file, options.format};
+    const auto total = Run(options, writer);
+    writer.Flush();
+    if (file != stdout) {
+        std::fclose(file);
+    }
+    const auto seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    std::fprintf(stderr, "seed %llu, %llu hands, %llu showdowns in %.2f s (%.0f hands/s)\n",
+                 static_cast<unsigned long long>(options.seed), static_cast<unsigned long long>(total.hands_played),
+                 static_cast<unsigned long long>(total.showdowns), seconds, total.hands_played / seconds);
+    for (std::size_t i = 0; i < poker::table::num_seats; ++i) {
+        if (options.config.buy_ins[i] != 0 && total.hands_played != 0 && options.config.big_blind > 0) {
+            std::fprintf(stderr, "seat %zu: %+lld chips, %+.2f bb/100\n", i, static_cast<long long>(total.chips_won[i]),
+                         100.0 * total.chips_won[i] / options.config.big_blind / total.hands_played);
+        }
+    }
+    return 0;
+} catch (const std::exception& e) {
+    std::fprintf(stderr, "%s\n", e.what());
+    return 1;
+}